@@ -47,6 +47,7 @@ module.exports.ODBCConnection = odbc.ODBCConnection;
 module.exports.ODBCStatement = odbc.ODBCStatement;
 module.exports.ODBCResult = odbc.ODBCResult;
 module.exports.loadODBCLibrary = odbc.loadODBCLibrary;
+module.exports.setTimestampZone = odbc.setTimestampZone;
 
 exports.debug = false;
 module.exports.debug = function(x) {
@@ -147,8 +148,15 @@ function Database(options)
   if(!ENV) ENV = self.odbc;
   self.queue = new SimpleQueue();
   self.fetchMode = options.fetchMode || null;
+  self.fetchSize = options.fetchSize || null;
+  self.bigintMode = options.bigintMode || null;
+  self.decimalMode = options.decimalMode || null;
+  self.charMode = options.charMode || null;
+  self.lazyRows = options.lazyRows || null;
   self.connected = false;
   self.connectTimeout = options.connectTimeout || null;
+  self.statementCacheSize = options.statementCacheSize || null;
+  self.statementPoolSize = options.statementPoolSize;
 } // Database()
 
 //Expose constants
@@ -197,6 +205,16 @@ Database.prototype.open = function (connStr, cb) {
       self.conn.connectTimeout = self.connectTimeout;
     }
 
+    if (self.statementCacheSize)
+    {
+      self.conn.statementCacheSize = self.statementCacheSize;
+    }
+
+    if (self.statementPoolSize || self.statementPoolSize === 0)
+    {
+      self.conn.statementPoolSize = self.statementPoolSize;
+    }
+
     self.conn.open(connStr, function (err, result)
     {
       if(cb)
@@ -231,6 +249,16 @@ Database.prototype.openSync = function (connStr)
     self.conn.connectTimeout = self.connectTimeout;
   }
 
+  if (self.statementCacheSize)
+  {
+    self.conn.statementCacheSize = self.statementCacheSize;
+  }
+
+  if (self.statementPoolSize || self.statementPoolSize === 0)
+  {
+    self.conn.statementPoolSize = self.statementPoolSize;
+  }
+
   if (typeof(connStr) === "object")
   {
     var obj = connStr;
@@ -301,6 +329,7 @@ Database.prototype.closeSync = function ()
 Database.prototype.query = function (query, params, cb)
 {
   var self = this, deferred, sql, resultset = [], multipleResultSet = false;
+  var onRow = (typeof query === 'object') ? query.onRow : null;
 
   //support for promises
   if (!cb && typeof params !== 'function')
@@ -343,8 +372,36 @@ Database.prototype.query = function (query, params, cb)
         {
           result.fetchMode = self.fetchMode;
         }
+        if (self.fetchSize)
+        {
+          result.fetchSize = self.fetchSize;
+        }
+        if (self.bigintMode)
+        {
+          result.bigintMode = self.bigintMode;
+        }
+        if (self.decimalMode)
+        {
+          result.decimalMode = self.decimalMode;
+        }
+        if (self.charMode)
+        {
+          result.charMode = self.charMode;
+        }
+        if (self.lazyRows)
+        {
+          result.lazyRows = true;
+        }
+
+        // with onRow the rows of every result set are handed to it one by
+        // one as they are fetched and never collected
+        var fetchRows = onRow ?
+          function (done) {
+            result.forEach(onRow, function (err) { done(err, []); });
+          } :
+          function (done) { result.fetchAll(done); };
 
-        result.fetchAll(function (err, data) {
+        fetchRows(function (err, data) {
           var moreResults, moreResultsError = null;
 
           // If there is any error, return it now only.
@@ -421,18 +478,28 @@ Database.prototype.query = function (query, params, cb)
     exports.debug && console.log("odbc.js:query() => %s", sql);
     if (params)
     {
-      if(Array.isArray(params))
+      //streams are sent by the execution of a prepared statement
+      if(hasParamStream(params))
       {
-        var err = parseParams(params);
-        if(err) deferred ? deferred.reject(err) : cb(err);
+        return executeStreams(self, query, params, cbQuery);
       }
-      if(typeof query === 'object')
+
+      //a malformed parameter object throws before the query is queued
+      try
       {
-          query.params = params;
-          self.conn.query(query, cbQuery);
+        if(typeof query === 'object')
+        {
+            query.params = params;
+            self.conn.query(query, cbQuery);
+        }
+        else
+            self.conn.query(query, params, cbQuery);
+      }
+      catch (err)
+      {
+        deferred ? deferred.reject(err) : cb(err, []);
+        return next();
       }
-      else
-          self.conn.query(query, params, cbQuery);
     }
     else
     {
@@ -472,18 +539,28 @@ Database.prototype.queryResult = function (query, params, cb)
     //ODBCConnection.query() is the fastest-path querying mechanism.
     if (params)
     {
-      if(Array.isArray(params))
+      //streams are sent by the execution of a prepared statement
+      if(hasParamStream(params))
       {
-        var err = parseParams(params);
-        if(err) cb(err);
+        return executeStreams(self, query, params, cbQuery);
       }
-      if(typeof query === 'object')
+
+      //a malformed parameter object throws before the query is queued
+      try
       {
-        query.params = params;
-        self.conn.query(query, cbQuery);
+        if(typeof query === 'object')
+        {
+          query.params = params;
+          self.conn.query(query, cbQuery);
+        }
+        else
+          self.conn.query(sql, params, cbQuery);
+      }
+      catch (err)
+      {
+        cb(err, null);
+        return next();
       }
-      else
-        self.conn.query(sql, params, cbQuery);
     }
     else
     {
@@ -502,6 +579,26 @@ Database.prototype.queryResult = function (query, params, cb)
       {
         result.fetchMode = self.fetchMode;
       }
+      if (self.fetchSize)
+      {
+        result.fetchSize = self.fetchSize;
+      }
+      if (self.bigintMode)
+      {
+        result.bigintMode = self.bigintMode;
+      }
+      if (self.decimalMode)
+      {
+        result.decimalMode = self.decimalMode;
+      }
+      if (self.charMode)
+      {
+        result.charMode = self.charMode;
+      }
+      if (self.lazyRows)
+      {
+        result.lazyRows = true;
+      }
 
       cb(err, result);
 
@@ -532,11 +629,6 @@ Database.prototype.queryResultSync = function (query, params)
   exports.debug && console.log("odbc.js:queryResultSync() => %s", sql);
   if (params)
   {
-    if(Array.isArray(params))
-    {
-        var err = parseParams(params);
-        if(err) cb(err);
-    }
     if(sql.search(/^call /i))
     {
       if(typeof query === 'object')
@@ -562,6 +654,26 @@ Database.prototype.queryResultSync = function (query, params)
   {
     result.fetchMode = self.fetchMode;
   }
+  if (self.fetchSize)
+  {
+    result.fetchSize = self.fetchSize;
+  }
+  if (self.bigintMode)
+  {
+    result.bigintMode = self.bigintMode;
+  }
+  if (self.decimalMode)
+  {
+    result.decimalMode = self.decimalMode;
+  }
+  if (self.charMode)
+  {
+    result.charMode = self.charMode;
+  }
+  if (self.lazyRows)
+  {
+    result.lazyRows = true;
+  }
 
   return result;
 }; // Database.queryResultSync
@@ -588,19 +700,23 @@ Database.prototype.querySync = function (query, params)
   exports.debug && console.log("odbc.js:querySync() => %s", sql);
   if (params)
   {
-    if(Array.isArray(params))
+    try
     {
-        var err = parseParams(params);
-        if(err) return err;
-    }
-    if(typeof query === 'object')
-    {
-        query.params = params;
-        result = self.conn.querySync(query);
+      if(typeof query === 'object')
+      {
+          query.params = params;
+          result = self.conn.querySync(query);
+      }
+      else 
+      {
+        result = self.conn.querySync(sql, params);
+      }
     }
-    else 
+    catch (err)
     {
-      result = self.conn.querySync(sql, params);
+      //malformed parameter objects are returned as before, SQL errors thrown
+      if(err instanceof TypeError) return err;
+      throw err;
     }
   }
   else
@@ -629,6 +745,26 @@ Database.prototype.querySync = function (query, params)
   {
     result.fetchMode = self.fetchMode;
   }
+  if (self.fetchSize)
+  {
+    result.fetchSize = self.fetchSize;
+  }
+  if (self.bigintMode)
+  {
+    result.bigintMode = self.bigintMode;
+  }
+  if (self.decimalMode)
+  {
+    result.decimalMode = self.decimalMode;
+  }
+  if (self.charMode)
+  {
+    result.charMode = self.charMode;
+  }
+  if (self.lazyRows)
+  {
+    result.lazyRows = true;
+  }
 
   while(moreResults)
   {
@@ -657,53 +793,90 @@ Database.prototype.querySync = function (query, params)
   return resultset;
 }; // Database.querySync
 
-Database.prototype.queryStream = function queryStream(sql, params) 
+// Rows are fetched in batches of options.highWaterMark rows (1024 by
+// default), one trip to the thread pool per batch, and the next batch is
+// only fetched once the consumer has drained the stream below that.
+Database.prototype.queryStream = function queryStream(sql, params, options) 
 {
   var self = this;
-  var stream = new Readable({ objectMode: true });
-  var results;
+  if (params && !Array.isArray(params) && !options)
+  {
+    options = params;
+    params = null;
+  }
+  var batchSize = (options && options.highWaterMark) || 1024;
+  var stream = new Readable({ objectMode: true, highWaterMark: batchSize });
+  var results, reading = false;
+  function read()
+  {
+    // a batch is still on its way, it fetches the next one if the stream
+    // wants more
+    if (reading) return;
+    reading = true;
+    return self.fetchStreamingResults(results, stream, batchSize, function ()
+    {
+      reading = false;
+    });
+  }
   stream._read = function() 
   {
     // after the first internal call to _read, the 'results' should be set
     // and the stream can continue fetching the results
-    if (results) return self.fetchStreamingResults(results, stream);
+    if (results) return read();
+    if (reading) return;
+    reading = true;
 
     // in the first call to _read the stream starts to emit data once we've 
     // queried for results
     return self.queryResult(sql, params, function (err, result) 
     {
+      reading = false;
       if (err) 
       {
         return process.nextTick(function () { stream.emit('error', err); });
       }
       results = result;
-      return self.fetchStreamingResults(results, stream);
+      return read();
     });
   };
   return stream;
 };
 
-Database.prototype.fetchStreamingResults = function(results, stream) 
+Database.prototype.fetchStreamingResults = function(results, stream, batchSize, cb) 
 {
   var self = this;
-  return results.fetch(function (err, data) 
+  // the stream gives rows, also when the connection fetches columns
+  var options = { fetchMode: results.fetchMode === odbc.ODBC.FETCH_ARRAY ?
+                  odbc.ODBC.FETCH_ARRAY : odbc.ODBC.FETCH_OBJECT };
+  batchSize = batchSize || 1;
+  cb = cb || function () {};
+
+  return results.fetchN(batchSize, options, function (err, rows) 
   {
     if (err) 
     {
+      cb();
       return process.nextTick(function () { stream.emit('error', err); });
     }
     // when no more data returns, return push null to indicate the end of stream
-    if (!data) 
+    if (!rows.length) 
     { 
+      cb();
       return stream.push(null);
     }
+    var more = true;
+    for (var i = 0; i < rows.length; i++)
+    {
+      more = stream.push(rows[i]);
+    }
     // if pushing the data returns 'true', that means we can query and push more 
     // immediately othewise the _read function will be called again (executing 
     // this function) once the reading party is ready to recieve more
-    if (stream.push(data))
+    if (more)
     {
-      return self.fetchStreamingResults(results, stream);
+      return self.fetchStreamingResults(results, stream, batchSize, cb);
     }
+    cb();
   });
 };
 
@@ -1007,6 +1180,30 @@ odbc.ODBCStatement.prototype._executeNonQuerySync = odbc.ODBCStatement.prototype
 odbc.ODBCStatement.prototype._prepare = odbc.ODBCStatement.prototype.prepare;
 odbc.ODBCStatement.prototype._bind = odbc.ODBCStatement.prototype.bind;
 odbc.ODBCStatement.prototype._bindSync = odbc.ODBCStatement.prototype.bindSync;
+odbc.ODBCStatement.prototype._executeBatch = odbc.ODBCStatement.prototype.executeBatch;
+odbc.ODBCStatement.prototype._executeBatchSync = odbc.ODBCStatement.prototype.executeBatchSync;
+
+//Streams among the parameters are bound with SQL_DATA_AT_EXEC and read as
+//the execution asks for their data, see ParamStream
+(function (proto) {
+  var bind = proto._bind
+    , bindSync = proto._bindSync
+    , execute = proto._execute
+    , executeNonQuery = proto._executeNonQuery;
+
+  proto._bind = function (params, cb) {
+    return bind.call(this, bindStreams(this, params), cb);
+  };
+  proto._bindSync = function (params) {
+    return bindSync.call(this, bindStreams(this, params));
+  };
+  proto._execute = function (cb) {
+    return execute.call(this, cb, pullParamData(this));
+  };
+  proto._executeNonQuery = function (cb) {
+    return executeNonQuery.call(this, cb, pullParamData(this));
+  };
+})(odbc.ODBCStatement.prototype);
 
 odbc.ODBCStatement.prototype.execute = function (params, cb)
 {
@@ -1035,50 +1232,15 @@ odbc.ODBCStatement.prototype.execute = function (params, cb)
     //then execute.
     if (params)
     {
-      if(Array.isArray(params))
+      //a malformed parameter object throws instead of calling back
+      try
       {
-        var err = parseParams(params);
-        if(err)
-        {
-          if(!deferred)
-          {
-            cb(err);
-          } else
-          {
-            deferred.reject(err);
-          }
-        }
+        self._bind(params, afterBind);
+      }
+      catch (err)
+      {
+        afterBind(err);
       }
-      self._bind(params, function (err) {
-        if (err) {
-          if(!deferred)
-          {
-            cb(err);
-          } else
-          {
-            deferred.reject(err);
-          }
-          return next();
-        }
-
-        self._execute(function (err, result, outparams) {
-          if(!deferred)
-          {
-            cb(err, result, outparams);
-          } else
-          {
-            if(err)
-            {
-              deferred.reject(err);
-            } else
-            {
-              deferred.resolve(result, outparams);
-            }
-          }
-
-          return next();
-        });
-      });
     }
     //Otherwise execute and pop the next bind call
     else
@@ -1107,6 +1269,37 @@ odbc.ODBCStatement.prototype.execute = function (params, cb)
         return next();
       });
     }
+
+    function afterBind (err) {
+      if (err) {
+        if(!deferred)
+        {
+          cb(err);
+        } else
+        {
+          deferred.reject(err);
+        }
+        return next();
+      }
+
+      self._execute(function (err, result, outparams) {
+        if(!deferred)
+        {
+          cb(err, result, outparams);
+        } else
+        {
+          if(err)
+          {
+            deferred.reject(err);
+          } else
+          {
+            deferred.resolve(result, outparams);
+          }
+        }
+
+        return next();
+      });
+    }
   });
   return deferred ? deferred.promise : null;
 };
@@ -1125,143 +1318,6 @@ odbc.ODBCStatement.prototype.executeSync = function (params)
   return self._executeSync();
 };
 
-function parseParams(params)
-{
-    var err, prm, paramtype, ctype, sqltype, datatype, data, len;
-    for (var i = 0; i < params.length; i++)
-    {
-        if(Object.prototype.toString.call(params[i]) == "[object Object]")
-        {
-            //{ParamType:"INPUT", DataType:"BLOB", Data:imgfile}
-            //{"ParamType":"INPUT", CType:"BINARY", SQLType:"BLOB",Data:imgfile}
-            paramtype = 1; ctype = undefined; sqltype = undefined;
-            datatype = undefined; data = undefined, len = 0;
-            prm = params[i];
-            if(prm.ParamType)
-            {
-                if(Number.isInteger(prm.ParamType))
-                {
-                    if(prm.ParamType > 0 && prm.ParamType < 5)
-                        paramtype = prm.ParamType;
-                }
-                else if(prm.ParamType == "OUTPUT")
-                    paramtype = 4; // SQL_PARAM_OUTPUT
-                else if(prm.ParamType == "INOUT")
-                    paramtype = 2; // SQL_PARAM_INPUT_OUTPUT
-                else if(prm.ParamType == "FILE")
-                    paramtype = 3; // SQLBindFileToParam()
-            }
-
-            if(prm.CType)
-            {
-                if(Number.isInteger(prm.CType))
-                {
-                    ctype = prm.CType;
-                }
-                else if(prm.CType == "CHAR")
-                    ctype = 1;
-                else if(prm.CType == "BINARY")
-                    ctype = -2;
-                else if(prm.CType == "INTEGER")
-                    ctype = 4;
-            }
-
-            // Either SQLType or DataType must be entered.
-            // If SQLType is used, DataType will be ignored.
-            if(prm.SQLType || prm.DataType)
-            {
-                var type = prm.SQLType || prm.DataType;
-                if(Number.isInteger(type))
-                {
-                    sqltype = type;
-                }
-                else if(type == "CHAR")
-                {
-                    sqltype = 1;                 // SQL_CHAR
-                    if(!ctype) ctype = sqltype;
-                }
-                else if(type == "BINARY")
-                {
-                    sqltype = -2;
-                    if(!ctype) ctype = sqltype;
-                }
-                else if(type == "BLOB")
-                {
-                    sqltype = -98;               // SQL_BLOB
-                    if(!ctype) ctype = -2;
-                }
-                else if(type == "CLOB")
-                {
-                    sqltype = -99;
-                    if(!ctype) ctype = 1;
-                }
-                else if(type == "DBCLOB")
-                {
-                    sqltype = -350;
-                    if(!ctype) ctype = sqltype;
-                }
-                else if(type == "XML")
-                {
-                    sqltype = -370;
-                    if(!ctype) ctype = 1;
-                }
-                else if(type == "GRAPHIC")
-                {
-                    sqltype = -95;
-                    if(!ctype) ctype = -99; //SQL_C_DBCHAR
-                }
-                else if(type == "VARGRAPHIC")
-                {
-                    sqltype = -96;
-                    if(!ctype) ctype = -99; //SQL_C_DBCHAR
-                }
-                else if(type == "LONGGRAPHIC")
-                {
-                    sqltype = -97;
-                    if(!ctype) ctype = -99; //SQL_C_DBCHAR
-                }
-            }
-            if(prm.Length > 0 && Number.isInteger(prm.Length))
-            {
-                len = prm.Length;
-            }
-
-            if(prm.Data === undefined )
-            {
-                err = "odbc.js:parseParams =>Data is missing from " + JSON.stringify(prm);
-                break;
-            }
-            if(Number.isInteger(prm.Data))
-            {
-                if(!ctype) ctype = -25; // SQL_C_SBIGINT
-                if(!sqltype) sqltype = -5; // SQL_BIGINT
-
-            }
-            else if( (paramtype == 4) && (prm.Data === "") )
-            {
-                prm.Data = "abc";
-            }
-
-            if(!ctype) ctype = 1;
-            if(!sqltype) sqltype = 1;
-            if(paramtype == 3) // For BindFileToParam()
-            {
-                ctype = 1;
-                if(!((sqltype == -98) || (sqltype == -99) ||
-                     (sqltype == -350) || (sqltype == -370)))
-                {
-                    err = "odbc.js:parseParams => DataType is missing form " + prm;
-                    break;
-                }
-            }
-
-            params[i] = [paramtype, ctype, sqltype, prm.Data, len];
-        }
-        //console.log(i + "th param = " + params[i]);
-    }
-    return err;
-}
-
 if(Number.isInteger === undefined)   // node.js < v0.12.0 do not support isInteger
 {
     Number.isInteger = function(x)
@@ -1307,56 +1363,58 @@ odbc.ODBCStatement.prototype.executeNonQuery = function (params, cb)
     //then executeNonQuery.
     if (params) 
     {
-      if(Array.isArray(params))
+      //a malformed parameter object throws instead of calling back
+      try
       {
-        var err = parseParams(params);
-        if(err) 
+        self._bind(params, afterBind);
+      }
+      catch (err)
+      {
+        afterBind(err);
+      }
+    }
+    //Otherwise executeNonQuery and pop the next bind call
+    else {
+      self._executeNonQuery(function (err, result) {
+        if(!deferred) 
         {
-          if(!deferred)
-          {
-            cb(err);
-          }
-          else
+          cb(err, result);
+        } 
+        else
+        {
+          if(err)
           {
             deferred.reject(err);
-          }
-        }
-      }
-      self._bind(params, function (err) {
-        if (err) {
-          if(!deferred) 
-          {
-            cb(err)
           } 
           else
           {
-            deferred.reject(err);
+            deferred.resolve(result);
           }
-          return next();
         }
 
-        self._executeNonQuery(function (err, result) {
-          if(!deferred) 
-          {
-            cb(err, result);
-          } 
-          else
-          {
-            if(err)
-            {
-              deferred.reject(err);
-            } 
-            else
-            {
-              deferred.resolve(result);
-            }
-          }
-          return next();
-        });
+        //NOTE: We only execute the next queued bind call after
+        // we have called execute() or executeNonQuery(). This ensures
+        // that we don't call a bind() a bunch of times without ever
+        // actually executing that bind. Not
+        self.bindQueue && self.bindQueue.next();
+
+        return next();
       });
     }
-    //Otherwise executeNonQuery and pop the next bind call
-    else {
+
+    function afterBind (err) {
+      if (err) {
+        if(!deferred) 
+        {
+          cb(err)
+        } 
+        else
+        {
+          deferred.reject(err);
+        }
+        return next();
+      }
+
       self._executeNonQuery(function (err, result) {
         if(!deferred) 
         {
@@ -1373,20 +1431,71 @@ odbc.ODBCStatement.prototype.executeNonQuery = function (params, cb)
             deferred.resolve(result);
           }
         }
+        return next();
+      });
+    }
+  });
+  return deferred ? deferred.promise : null;
+};
 
-        //NOTE: We only execute the next queued bind call after
-        // we have called execute() or executeNonQuery(). This ensures
-        // that we don't call a bind() a bunch of times without ever
-        // actually executing that bind. Not
-        self.bindQueue && self.bindQueue.next();
+// Executes the prepared statement once for every row of parameters in one
+// trip to the server. Takes an Array of rows, each an Array of values, or
+// { columns : [...] } with an Array of values per parameter. Calls back with
+// { rowCount, processed, status }, status holding a SQL_PARAM_* code per row;
+// on error the same object is passed after the error.
+odbc.ODBCStatement.prototype.executeBatch = function (rowsOrColumns, cb)
+{
+  var self = this, deferred;
+
+  if (!cb)
+  {
+    deferred = Q.defer();
+  }
+
+  self.queue = self.queue || new SimpleQueue();
+
+  self.queue.push(function (next) {
+    var columnar = !Array.isArray(rowsOrColumns);
+
+    try
+    {
+      self._executeBatch(columnar ? rowsOrColumns.columns : rowsOrColumns,
+                         columnar, function (err, result) {
+        if (!deferred)
+        {
+          cb(err, result);
+        }
+        else if (err)
+        {
+          err.result = result;
+          deferred.reject(err);
+        }
+        else
+        {
+          deferred.resolve(result);
+        }
 
         return next();
       });
     }
+    catch (err)
+    {
+      deferred ? deferred.reject(err) : cb(err);
+
+      return next();
+    }
   });
   return deferred ? deferred.promise : null;
 };
 
+odbc.ODBCStatement.prototype.executeBatchSync = function (rowsOrColumns)
+{
+  var columnar = !Array.isArray(rowsOrColumns);
+
+  return this._executeBatchSync(columnar ? rowsOrColumns.columns
+                                         : rowsOrColumns, columnar);
+};
+
 odbc.ODBCStatement.prototype.prepare = function (sql, cb) {
   var self = this;
 
@@ -1408,32 +1517,323 @@ odbc.ODBCStatement.prototype.bind = function (ary, cb) {
   self.bindQueue = self.bindQueue || new SimpleQueue();
 
   self.bindQueue.push(function () {
-    if(Array.isArray(ary))
+    //NOTE: we do not call next() here because
+    //we want to pop the next bind call only
+    //after the next execute call
+    try
     {
-      var err = parseParams(ary);
-      if(err) cb(err);
+      self._bind(ary, function (err) {
+        cb(err);
+      });
     }
-    self._bind(ary, function (err) {
+    catch (err)
+    {
       cb(err);
-
-      //NOTE: we do not call next() here because
-      //we want to pop the next bind call only
-      //after the next execute call
-    });
+    }
   });
 };
 
 // Async Function to bind parameters before execute or executeSync
 odbc.ODBCStatement.prototype.bindSync = function (ary) {
     var self = this;
-    if(Array.isArray(ary))
+    try
+    {
+      return self._bindSync(ary);
+    }
+    catch (err)
+    {
+      //a malformed parameter object fails the bind like a driver error
+      if (err instanceof TypeError) return false;
+      throw err;
+    }
+};
+
+odbc.ODBCResult.prototype._fetch = odbc.ODBCResult.prototype.fetch;
+
+// With { streamLobs : true } the LOB columns of the row are not read by
+// fetch; each non-NULL one is a Readable stream over the value instead.
+// streamLobs can also be an Array of the names or positions of the LOB
+// columns to stream, the others are read as usual. Streams of a row must
+// be read before the next fetch moves the cursor; after it they fail.
+odbc.ODBCResult.prototype.fetch = function (options, cb)
+{
+  var self = this;
+  if (typeof options === 'function' || !options || !options.streamLobs)
+  {
+    self._fetch.apply(self, arguments);
+    return wakeLobStreams(self);
+  }
+
+  if (Array.isArray(options.streamLobs))
+  {
+    var columns = self.getColumnNamesSync(), picked = {};
+
+    for (var key in options) picked[key] = options[key];
+    picked.streamLobs = options.streamLobs.map(function (column) {
+      return typeof column === 'string' ? columns.indexOf(column) : column;
+    });
+    options = picked;
+  }
+
+  self._fetch(options, function (err, row)
+  {
+    if (row)
     {
-      var err = parseParams(ary);
-      if(err) return false;
+      var names = Array.isArray(row) ? null : self.getColumnNamesSync();
+      Object.keys(row).forEach(function (key)
+      {
+        if (row[key] !== undefined) return;
+        var column = names ? names.indexOf(key) : Number(key);
+        row[key] = self.getLobStream(column, options);
+      });
     }
-    return self._bindSync(ary); 
+    cb(err, row);
+  });
+  wakeLobStreams(self);
 };
 
+// The streams left waiting for a LOB of the row the cursor just moved off
+// read again, only to fail.
+function wakeLobStreams(result)
+{
+  var waiting = result._lobWaiting || [];
+
+  result._lobStream = null;
+  result._lobWaiting = [];
+  waiting.forEach(function (read) { read(); });
+}
+
+// Readable stream over a LOB column left unread by fetch({ streamLobs : true }).
+// Each read is one trip to the thread pool for up to options.chunkSize bytes
+// (64KB by default), and the next one is only made when the consumer asks
+// for more. Character LOBs are read as strings. SQLGetData on one column
+// loses the place in any other, so the LOBs of a row are read one at a
+// time: a stream waits until the one being read has ended.
+odbc.ODBCResult.prototype.getLobStream = function (column, options)
+{
+  var self = this
+    , chunkSize = (options && options.chunkSize) || 65536
+    , stream = new Readable()
+    , row = self.rowGeneration
+    , text = false;
+
+  if (typeof column === 'string')
+    column = self.getColumnNamesSync().indexOf(column);
+
+  function fail(err)
+  {
+    process.nextTick(function () { stream.emit('error', err); });
+  }
+
+  function done()
+  {
+    if (self._lobStream === stream) wakeLobStreams(self);
+  }
+
+  stream._read = function read()
+  {
+    if (self._lobStream && self._lobStream !== stream)
+      return self._lobWaiting.push(read);
+
+    self._lobStream = stream;
+    self._lobWaiting = self._lobWaiting || [];
+
+    try
+    {
+      self.getData(column, chunkSize, row, function (err, chunk, more)
+      {
+        if (err || !more) done();
+        if (err) return fail(err);
+
+        if (typeof chunk === 'string' && !text)
+        {
+          text = true;
+          stream.setEncoding('utf8');
+        }
+        stream.push(chunk);
+        if (chunk !== null && !more) stream.push(null);
+      });
+    }
+    catch (err)
+    {
+      done();
+      fail(err);
+    }
+  };
+  return stream;
+};
+
+
+// A Readable stream or an async iterator bound as a parameter, directly or
+// as the Data of a parameter object. Its chunks are sent with SQLPutData one
+// at a time as execute() or executeNonQuery() asks for them, so a large LOB
+// never has to be held in memory as a whole.
+function isParamStream(value)
+{
+  return value !== null && typeof value === 'object' &&
+         !Buffer.isBuffer(value) && !Array.isArray(value) &&
+         ((typeof value.read === 'function' && typeof value.on === 'function') ||
+          (typeof Symbol === 'function' && !!Symbol.asyncIterator &&
+           typeof value[Symbol.asyncIterator] === 'function'));
+}
+
+function hasParamStream(params)
+{
+  return Array.isArray(params) && params.some(function (param) {
+    return isParamStream(param) ||
+           (param !== null && typeof param === 'object' &&
+            isParamStream(param.Data));
+  });
+}
+
+function ParamStream(source)
+{
+  var self = this;
+
+  self.source = source;
+  self.iterator = null;
+  self.ended = false;
+  self.error = null;
+  self.done = false;  // read to the end by an execution
+
+  if (typeof source.read === 'function' && typeof source.on === 'function')
+  {
+    source.on('end', function () { self.ended = true; });
+    source.on('error', function (err) { self.error = err; });
+  }
+}
+
+// Calls back with the next chunk as a Buffer, or with null at the end.
+ParamStream.prototype.next = function (cb)
+{
+  var self = this, source = self.source, chunk;
+
+  function done(err, chunk)
+  {
+    if (err) return cb(err);
+    if (chunk === null || chunk === undefined)
+    {
+      self.done = true;
+      return cb(null, null);
+    }
+    if (typeof chunk === 'string')
+      chunk = Buffer.from ? Buffer.from(chunk) : new Buffer(chunk);
+    cb(null, chunk);
+  }
+
+  if (self.error) return cb(self.error);
+
+  if (typeof source.read !== 'function' || typeof source.on !== 'function')
+  {
+    self.iterator = self.iterator || source[Symbol.asyncIterator]();
+    return self.iterator.next().then(function (item) {
+      done(null, item.done ? null : item.value);
+    }, done);
+  }
+
+  chunk = source.read();
+  if (chunk !== null) return done(null, chunk);
+  if (self.error) return cb(self.error);
+  if (self.ended) return done(null, null);
+
+  function retry()
+  {
+    source.removeListener('readable', retry);
+    source.removeListener('end', retry);
+    source.removeListener('error', retry);
+    self.next(cb);
+  }
+  source.on('readable', retry);
+  source.on('end', retry);
+  source.on('error', retry);
+};
+
+// Runs a query with stream parameters for query() and queryResult() on a
+// statement prepared for it. The result holds on to the statement, so it is
+// not collected while the rows are read, and closing the result closes it.
+// With noResults the result is closed at once, as conn.query() would.
+function executeStreams(db, query, params, cb)
+{
+  var sql = typeof query === 'object' ? query.sql : query
+    , noResults = typeof query === 'object' && !!query.noResults;
+
+  db.prepare(sql, function (err, stmt) {
+    if (err) return cb(err);
+
+    stmt.execute(params, function (err, result, outparams) {
+      if (err || !result || noResults)
+      {
+        if (result) result.closeSync();
+        stmt.closeSync();
+        return cb(err, noResults ? null : result, outparams);
+      }
+
+      var closeSync = result.closeSync;
+
+      result.statement = stmt;
+      result.closeSync = function () {
+        var ret = closeSync.apply(result, arguments);
+        stmt.closeSync();
+        return ret;
+      };
+      cb(err, result, outparams);
+    });
+  });
+}
+
+// Binds each stream in params as a parameter object with the stream as its
+// Data, which the native bind leaves for SQL_DATA_AT_EXEC, and keeps a
+// ParamStream for it on the statement. A bare stream is a BLOB.
+function bindStreams(stmt, params)
+{
+  var streams = null, bound = params;
+
+  if (hasParamStream(params))
+  {
+    streams = {};
+    bound = params.slice();
+
+    params.forEach(function (param, i) {
+      if (isParamStream(param))
+      {
+        streams[i] = new ParamStream(param);
+        bound[i] = { ParamType : "INPUT", DataType : "BLOB", Data : param };
+      }
+      else if (param !== null && typeof param === 'object' &&
+               isParamStream(param.Data))
+      {
+        streams[i] = new ParamStream(param.Data);
+      }
+    });
+  }
+  stmt._paramStreams = streams;
+  return bound;
+}
+
+// The function the native execute calls with the index of each parameter it
+// wants data for. It answers with putData() until the stream is read to the
+// end; a stream can only be read by one execution.
+function pullParamData(stmt)
+{
+  var streams = stmt._paramStreams, started = {};
+
+  if (!streams) return undefined;
+
+  return function (index) {
+    var stream = streams[index];
+
+    if (!stream)
+      return stmt.putData(new Error("Parameter " + index + " is not a stream"));
+    if (stream.done && !started[index])
+      return stmt.putData(new Error("The stream of parameter " + index +
+                                    " was read by an earlier execution"));
+    started[index] = true;
+
+    stream.next(function (err, chunk) {
+      stmt.putData(err || chunk);
+    });
+  };
+}
 
 module.exports.Pool = Pool;
 
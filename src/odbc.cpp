@@ -16,6 +16,7 @@
 */
 
 #include <string.h>
+#include <math.h>
 #include <v8.h>
 #include <node.h>
 #include <node_version.h>
@@ -42,6 +43,20 @@ using namespace node;
 
 uv_mutex_t ODBC::g_odbcMutex;
 uv_async_t ODBC::g_async;
+#ifdef TIMEGM
+int ODBC::g_timestampZone = TIMESTAMP_UTC;
+#else
+int ODBC::g_timestampZone = TIMESTAMP_LOCAL;
+#endif
+double ODBC::g_timestampOffset = 0;
+LocalOffset ODBC::g_localOffsets[LOCAL_OFFSET_CACHE_SIZE];
+Nan::Persistent<String> ODBC::PROPERTY_MICROSECONDS;
+Nan::Persistent<String> ODBC::PROPERTY_PARAM_TYPE;
+Nan::Persistent<String> ODBC::PROPERTY_CTYPE;
+Nan::Persistent<String> ODBC::PROPERTY_SQL_TYPE;
+Nan::Persistent<String> ODBC::PROPERTY_DATA_TYPE;
+Nan::Persistent<String> ODBC::PROPERTY_LENGTH;
+Nan::Persistent<String> ODBC::PROPERTY_DATA;
 
 Nan::Persistent<Function> ODBC::constructor;
 
@@ -66,6 +81,19 @@ void ODBC::Init(v8::Handle<Object> exports) {
   constructor_template->Set(Nan::New<String>("SQL_DESTROY").ToLocalChecked(), Nan::New<Number>(SQL_DESTROY), constant_attributes);
   constructor_template->Set(Nan::New<String>("FETCH_ARRAY").ToLocalChecked(), Nan::New<Number>(FETCH_ARRAY), constant_attributes);
   NODE_ODBC_DEFINE_CONSTANT(constructor_template, FETCH_OBJECT);
+  NODE_ODBC_DEFINE_CONSTANT(constructor_template, FETCH_COLUMNAR);
+  NODE_ODBC_DEFINE_CONSTANT(constructor_template, BIGINT_STRING);
+  NODE_ODBC_DEFINE_CONSTANT(constructor_template, BIGINT_NATIVE);
+  NODE_ODBC_DEFINE_CONSTANT(constructor_template, DECIMAL_STRING);
+  NODE_ODBC_DEFINE_CONSTANT(constructor_template, DECIMAL_DOUBLE);
+  NODE_ODBC_DEFINE_CONSTANT(constructor_template, DECIMAL_EXACT);
+  NODE_ODBC_DEFINE_CONSTANT(constructor_template, CHAR_WIDE);
+  NODE_ODBC_DEFINE_CONSTANT(constructor_template, CHAR_UTF8);
+  NODE_ODBC_DEFINE_CONSTANT(constructor_template, SQL_PARAM_SUCCESS);
+  NODE_ODBC_DEFINE_CONSTANT(constructor_template, SQL_PARAM_SUCCESS_WITH_INFO);
+  NODE_ODBC_DEFINE_CONSTANT(constructor_template, SQL_PARAM_ERROR);
+  NODE_ODBC_DEFINE_CONSTANT(constructor_template, SQL_PARAM_UNUSED);
+  NODE_ODBC_DEFINE_CONSTANT(constructor_template, SQL_PARAM_DIAG_UNAVAILABLE);
   
   // Prototype Methods
   Nan::SetPrototypeMethod(constructor_template, "createConnection", CreateConnection);
@@ -76,6 +104,15 @@ void ODBC::Init(v8::Handle<Object> exports) {
   exports->Set(Nan::New("ODBC").ToLocalChecked(),
                constructor_template->GetFunction());
   
+  Nan::SetMethod(exports, "setTimestampZone", SetTimestampZone);
+  PROPERTY_MICROSECONDS.Reset(Nan::New("microseconds").ToLocalChecked());
+  PROPERTY_PARAM_TYPE.Reset(Nan::New("ParamType").ToLocalChecked());
+  PROPERTY_CTYPE.Reset(Nan::New("CType").ToLocalChecked());
+  PROPERTY_SQL_TYPE.Reset(Nan::New("SQLType").ToLocalChecked());
+  PROPERTY_DATA_TYPE.Reset(Nan::New("DataType").ToLocalChecked());
+  PROPERTY_LENGTH.Reset(Nan::New("Length").ToLocalChecked());
+  PROPERTY_DATA.Reset(Nan::New("Data").ToLocalChecked());
+  
 #if NODE_VERSION_AT_LEAST(0, 7, 9)
   // Initialize uv_async so that we can prevent node from exiting
   //uv_async_init( uv_default_loop(),
@@ -255,12 +292,14 @@ NAN_METHOD(ODBC::CreateConnectionSync) {
 
 /*
  * GetColumns
+ *
+ * Describes the columns of the current result set. The Column array and the
+ * names live in one allocation, freed by FreeColumns.
  */
 
 Column* ODBC::GetColumns(SQLHSTMT hStmt, short* colCount) {
   SQLRETURN ret;
   SQLSMALLINT buflen;
-  SQLSMALLINT typebuflen;
 
   //always reset colCount for the current result set to 0;
   *colCount = 0; 
@@ -268,22 +307,33 @@ Column* ODBC::GetColumns(SQLHSTMT hStmt, short* colCount) {
   //get the number of columns in the result set
   ret = SQLNumResultCols(hStmt, colCount);
   
-  if (!SQL_SUCCEEDED(ret)) {
-    return new Column[0];
+  if (!SQL_SUCCEEDED(ret) || *colCount <= 0) {
+    *colCount = 0;
+    return NULL;
   }
   
-  Column *columns = new Column[*colCount];
+  size_t header = ALIGN_SQLLEN(*colCount * sizeof(Column));
+  size_t size = header;
+  size_t capacity = header + *colCount * COLUMN_NAME_SIZE_HINT;
+  char *arena = (char *) malloc(capacity);
   char colname[MAX_FIELD_SIZE];
 
+  if (!arena) {
+    *colCount = 0;
+    return NULL;
+  }
+
   for (int i = 0; i < *colCount; i++) {
+    Column *column = (Column *) arena + i;
+
     //save the index number of this column
-    columns[i].index = i + 1;
+    column->index = i + 1;
     colname[0] = '\0';
     buflen = 0;
     
     //get the column name
     ret = SQLColAttribute( hStmt,
-                           columns[i].index,
+                           column->index,
 #ifdef STRICT_COLUMN_NAMES
                            SQL_DESC_NAME,
 #else
@@ -295,52 +345,217 @@ Column* ODBC::GetColumns(SQLHSTMT hStmt, short* colCount) {
                            NULL);
     
     //store the len attribute
-    columns[i].len = buflen;
-    if(buflen> 0)
+    if(!SQL_SUCCEEDED(ret) || buflen < 0)
     {
-        columns[i].name = new unsigned char[buflen+2];
-        memcpy(columns[i].name, colname, buflen);
-        columns[i].name[buflen] = '\0';
-        columns[i].name[buflen+1] = '\0';
+        buflen = 0;
+    }
+    if (buflen > MAX_FIELD_SIZE - 2) {
+      buflen = MAX_FIELD_SIZE - 2;
     }
-    DEBUG_PRINTF("ODBC::GetColumns index = %i, buflen=%i\n", columns[i].index, buflen);
+    column->len = buflen;
+    DEBUG_PRINTF("ODBC::GetColumns index = %i, buflen=%i\n", column->index, buflen);
+
+    if (size + buflen + 2 > capacity) {
+      capacity = (size + buflen + 2) * 2;
+
+      char *grown = (char *) realloc(arena, capacity);
+
+      if (!grown) {
+        free(arena);
+        *colCount = 0;
+        return NULL;
+      }
+
+      arena = grown;
+      column = (Column *) arena + i;
+    }
+
+    memcpy(arena + size, colname, buflen);
+    arena[size + buflen] = '\0';
+    arena[size + buflen + 1] = '\0';
+
+    //an offset until the arena stops moving, see below
+    column->name = (unsigned char *) (uintptr_t) size;
+    size += buflen + 2;
     
     //get the column type and store it directly in column[i].type
     ret = SQLColAttribute( hStmt,
-                           columns[i].index,
+                           column->index,
                            SQL_DESC_CONCISE_TYPE,
                            NULL,
                            0,
                            NULL,
-                           &columns[i].type);
-						   
-	columns[i].type_name = new unsigned char[(MAX_FIELD_SIZE)];
-    
-    //set the first byte of type_name to \0 instead of memsetting the entire buffer
-    columns[i].type_name[0] = '\0';
-	
-	ret = SQLColAttribute( hStmt,
-                           columns[i].index,
-                           SQL_DESC_TYPE_NAME,
-                           columns[i].type_name,
-                           (SQLSMALLINT) (MAX_FIELD_SIZE),
-                           &typebuflen,
-                           NULL);
+                           &column->type);
+
+    //get the sizes the fetch buffers are fitted to; 0 when unknown
+    column->octetLength = 0;
+    column->displaySize = 0;
+    column->c_type = 0;
+
+    ret = SQLColAttribute( hStmt,
+                           column->index,
+                           SQL_DESC_OCTET_LENGTH,
+                           NULL,
+                           0,
+                           NULL,
+                           &column->octetLength);
+
+    if (!SQL_SUCCEEDED(ret)) {
+      column->octetLength = 0;
+    }
+
+    ret = SQLColAttribute( hStmt,
+                           column->index,
+                           SQL_DESC_DISPLAY_SIZE,
+                           NULL,
+                           0,
+                           NULL,
+                           &column->displaySize);
+
+    if (!SQL_SUCCEEDED(ret)) {
+      column->displaySize = 0;
+    }
+  }
+
+  Column *columns = (Column *) arena;
+
+  for (int i = 0; i < *colCount; i++) {
+    columns[i].name = (unsigned char *) arena + (uintptr_t) columns[i].name;
   }
+
   return columns;
 }
 
 /*
- * FreeColumns
+ * GetColumnWidth
+ *
+ * Bytes a value of the column takes when read as SQL_C_TCHAR, without the
+ * terminator; 0 for LOB columns and columns of unknown or excessive size.
  */
 
-void ODBC::FreeColumns(Column* columns, short* colCount) {
-  for(int i = 0; i < *colCount; i++) {
-      delete [] columns[i].name;
-      delete [] columns[i].type_name;
+SQLLEN ODBC::GetColumnWidth(Column* column) {
+  switch ((int) column->type) {
+    case SQL_BLOB :
+    case SQL_CLOB :
+    case SQL_DBCLOB :
+    case SQL_XML :
+    case SQL_LONGVARCHAR :
+    case SQL_WLONGVARCHAR :
+    case SQL_LONGVARBINARY :
+      return 0;
+  }
+
+  if (column->displaySize <= 0 ||
+      column->displaySize * (SQLLEN) sizeof(SQLTCHAR) > MAX_COLUMN_BUFFER_SIZE) {
+    return 0;
+  }
+
+  return column->displaySize * sizeof(SQLTCHAR);
+}
+
+/*
+ * GetColumnBufferLength
+ *
+ * Length of a GetColumnValue buffer that holds a value of any non-LOB
+ * column of the result set, so those are read with a single SQLGetData.
+ */
+
+int ODBC::GetColumnBufferLength(Column* columns, short colCount) {
+  SQLLEN length = MAX_VALUE_SIZE;
+
+  for (int i = 0; i < colCount; i++) {
+    SQLLEN width = GetColumnWidth(&columns[i]);
+
+    if (width > length) {
+      length = width;
+    }
+  }
+
+  return (int) length;
+}
+
+/*
+ * SetNumericTypes
+ *
+ * Picks the C type BIGINT, DECIMAL and NUMERIC columns are fetched as for
+ * the bigintMode and decimalMode of a result. BIGINT_NATIVE needs BigInt,
+ * without it BIGINT stays a string. Does not touch V8, so it may run on the
+ * thread pool.
+ */
+
+void ODBC::SetNumericTypes(Column* columns, short colCount, int bigintMode,
+                           int decimalMode) {
+  for (int i = 0; i < colCount; i++) {
+    columns[i].c_type = 0;
+
+    switch ((int) columns[i].type) {
+#ifdef HAVE_BIGINT
+      case SQL_BIGINT :
+        if (bigintMode == BIGINT_NATIVE) {
+          columns[i].c_type = SQL_C_SBIGINT;
+        }
+        break;
+#endif
+
+      case SQL_DECIMAL :
+      case SQL_NUMERIC :
+        if (decimalMode == DECIMAL_DOUBLE) {
+          columns[i].c_type = SQL_C_DOUBLE;
+        }
+        else if (decimalMode == DECIMAL_EXACT) {
+          columns[i].c_type = SQL_C_CHAR;
+        }
+        break;
+    }
+  }
+}
+
+/*
+ * SetCharTypes
+ *
+ * With CHAR_UTF8 fetches the columns that would be read as wide characters
+ * as SQL_C_CHAR instead. Call after SetNumericTypes, whose choices it keeps.
+ * XML and DBCLOB stay wide. Does not touch V8, so it may run on the thread
+ * pool.
+ */
+
+void ODBC::SetCharTypes(Column* columns, short colCount, int charMode) {
+  if (charMode != CHAR_UTF8) {
+    return;
+  }
+
+  for (int i = 0; i < colCount; i++) {
+    if (columns[i].c_type != 0) {
+      continue;
+    }
+
+    switch ((int) columns[i].type) {
+      case SQL_CHAR :
+      case SQL_VARCHAR :
+      case SQL_LONGVARCHAR :
+      case SQL_WCHAR :
+      case SQL_WVARCHAR :
+      case SQL_WLONGVARCHAR :
+      case SQL_CLOB :
+      case SQL_TYPE_DATE :
+      case SQL_TYPE_TIME :
+      case SQL_TYPE_TIMESTAMP :
+      case SQL_BIGINT :
+      case SQL_DECIMAL :
+      case SQL_NUMERIC :
+        columns[i].c_type = SQL_C_CHAR;
+        break;
+    }
   }
+}
+
+/*
+ * FreeColumns
+ */
 
-  delete [] columns;
+void ODBC::FreeColumns(Column* columns, short* colCount) {
+  //the names are in the same allocation
+  free(columns);
   
   *colCount = 0;
 }
@@ -369,6 +584,34 @@ Handle<Value> ODBC::GetColumnValue( SQLHSTMT hStmt, Column column,
   //reset the buffer
   buffer[0] = '\0';
 
+  //UTF-8 as chosen by SetNumericTypes or SetCharTypes, read like wide
+  //strings below
+  if (column.c_type == SQL_C_CHAR) {
+    ctype = SQL_C_CHAR;
+    terCharLen = 1;
+  }
+  //BIGINT and DECIMAL as chosen by SetNumericTypes
+  else if (column.c_type != 0) {
+    SQLBIGINT value[MAX_FIELD_SIZE / sizeof(SQLBIGINT)];
+
+    ret = SQLGetData( hStmt,
+                      column.index,
+                      column.c_type,
+                      value,
+                      sizeof(value),
+                      &len);
+
+    DEBUG_PRINTF("ODBC::GetColumnValue - Numeric: index=%i name=%s type=%i c_type=%i len=%i ret=%i\n",
+                 column.index, column.name, column.type, column.c_type, len, ret);
+
+    if (!SQL_SUCCEEDED(ret)) {
+      Nan::ThrowError(ODBC::GetSQLError( SQL_HANDLE_STMT, hStmt, errmsg));
+      return scope.Escape(Nan::Undefined());
+    }
+
+    return scope.Escape(GetCellValue(column.c_type, len, (char *) value));
+  }
+
   switch ((int) column.type) 
   {
     case SQL_INTEGER : 
@@ -433,17 +676,11 @@ Handle<Value> ODBC::GetColumnValue( SQLHSTMT hStmt, Column column,
         SQL_TIMESTAMP_STRUCT odbcTime;
 
         #ifdef _WIN32
-        struct tm timeInfo = {};
         ret = SQLGetData(hStmt, column.index, SQL_C_CHAR, 
                          &odbcTime, sizeof(odbcTime), &len);
         #else
-          #ifdef _AIX
-          struct tm timeInfo = {0,0,0,0,0,0,0,0,0};
-          #else
-          struct tm timeInfo = {0,0,0,0,0,0,0,0,0,0,0};
-          #endif
-          ret = SQLGetData(hStmt, column.index, SQL_C_TYPE_TIMESTAMP, 
-                           &odbcTime, sizeof(odbcTime), &len);
+        ret = SQLGetData(hStmt, column.index, SQL_C_TYPE_TIMESTAMP, 
+                         &odbcTime, sizeof(odbcTime), &len);
         #endif
 
         DEBUG_PRINTF("ODBC::GetColumnValue - Unix Timestamp: index=%i name=%s "
@@ -453,26 +690,7 @@ Handle<Value> ODBC::GetColumnValue( SQLHSTMT hStmt, Column column,
           return scope.Escape(Nan::Null());
         }
         else {
-          timeInfo.tm_year = odbcTime.year - 1900;
-          timeInfo.tm_mon = odbcTime.month - 1;
-          timeInfo.tm_mday = odbcTime.day;
-          timeInfo.tm_hour = odbcTime.hour;
-          timeInfo.tm_min = odbcTime.minute;
-          timeInfo.tm_sec = odbcTime.second;
-
-          //a negative value means that mktime() should use timezone information 
-          //and system databases to attempt to determine whether DST is in effect 
-          //at the specified time.
-          timeInfo.tm_isdst = -1;
-
-          #ifdef TIMEGM
-          return scope.Escape(Nan::New<Date>((double(timegm(&timeInfo)) * 1000) + 
-                      (odbcTime.fraction / 1000000)).ToLocalChecked());
-          #else
-          return scope.Escape(Nan::New<Date>((double(mktime(&timeInfo)) * 1000) + 
-                      (odbcTime.fraction / 1000000)).ToLocalChecked());
-
-          #endif
+          return scope.Escape(GetTimestampValue(&odbcTime));
         }
       } 
       break;
@@ -498,6 +716,36 @@ Handle<Value> ODBC::GetColumnValue( SQLHSTMT hStmt, Column column,
         }
       }
       break;
+
+    case SQL_BINARY :
+    case SQL_VARBINARY :
+    case SQL_LONGVARBINARY :
+    case SQL_BLOB :
+      {
+        char *data = NULL;
+        bool outOfMemory = false;
+
+        ret = GetBinaryData(hStmt, column.index, &data, &len, &outOfMemory);
+
+        DEBUG_PRINTF("ODBC::GetColumnValue - Binary: index=%i name=%s type=%i len=%i ret=%i\n",
+                     column.index, column.name, column.type, len, ret);
+
+        if (!SQL_SUCCEEDED(ret)) {
+          if (outOfMemory) {
+            errmsg = (char*)"Failed to allocate memory buffer for column data.";
+          }
+          Nan::ThrowError(ODBC::GetSQLError( SQL_HANDLE_STMT, hStmt, errmsg));
+          return scope.Escape(Nan::Undefined());
+        }
+        else if ((int)len == SQL_NULL_DATA) {
+          return scope.Escape(Nan::Null());
+        }
+        else {
+          //the Buffer takes over data
+          return scope.Escape(Nan::NewBuffer(data, len).ToLocalChecked());
+        }
+      }
+      break;
 	/*
 	case SQL_NUMERIC :
     case SQL_DECIMAL :
@@ -522,13 +770,6 @@ Handle<Value> ODBC::GetColumnValue( SQLHSTMT hStmt, Column column,
             terCharLen = 2;
             DEBUG_PRINTF("DBCLOB DATA SELECTED\n");
         }
-    case SQL_BLOB :
-        if((int) column.type == SQL_BLOB)
-        {
-            terCharLen = 0;
-            ctype = SQL_C_BINARY;
-            DEBUG_PRINTF("BLOB DATA SELECTED\n");
-        }
     default :
       uint16_t * tmp_out_ptr = NULL;
       int newbufflen = 0;
@@ -585,15 +826,16 @@ Handle<Value> ODBC::GetColumnValue( SQLHSTMT hStmt, Column column,
       // so return the result irrespective of ret as we already have some data.
       else if (SQL_SUCCEEDED(ret) || secondGetData) 
       {
-          if(ctype == SQL_C_BINARY)
-              str = Nan::NewOneByteString((uint8_t *) buffer, newbufflen).ToLocalChecked();
+          #ifdef UNICODE
+          if (ctype == SQL_C_CHAR) {
+            str = GetUtf8Value((char *) buffer, strlen((char *) buffer));
+          }
           else {
-            #ifdef UNICODE
-            str = Nan::New((uint16_t *) buffer).ToLocalChecked();
-            #else
-            str = Nan::New((char *) buffer).ToLocalChecked();
-            #endif
+            str = GetWideValue(buffer);
           }
+          #else
+          str = GetUtf8Value((char *) buffer, strlen((char *) buffer));
+          #endif
           if(tmp_out_ptr) free(tmp_out_ptr);
           //return scope.Escape(Nan::CopyBuffer((char*)buffer, 39767).ToLocalChecked());
       }
@@ -620,11 +862,145 @@ Handle<Value> ODBC::GetColumnValue( SQLHSTMT hStmt, Column column,
   }
 }
 
+/*
+ * GetTimestampValue
+ *
+ * Date of a timestamp in the zone chosen with setTimestampZone(), without
+ * calling mktime or timegm per value.
+ */
+
+Local<Value> ODBC::GetTimestampValue(SQL_TIMESTAMP_STRUCT* odbcTime)
+{
+  Nan::EscapableHandleScope scope;
+
+  //the fields read as UTC
+  double seconds = DaysFromCivil(odbcTime->year, odbcTime->month, odbcTime->day) * 86400 +
+                   odbcTime->hour * 3600 + odbcTime->minute * 60 + odbcTime->second;
+
+  switch (g_timestampZone) {
+    case TIMESTAMP_UTC :
+      break;
+
+    case TIMESTAMP_OFFSET :
+      seconds -= g_timestampOffset;
+      break;
+
+    default :
+      seconds -= GetLocalOffset(odbcTime, seconds);
+      break;
+  }
+
+  Local<Date> date = Nan::New<Date>((seconds * 1000) +
+                       (odbcTime->fraction / 1000000)).ToLocalChecked();
+
+  //a Date stops at milliseconds, so finer values carry their microseconds
+  if (odbcTime->fraction % 1000000) {
+    date->Set(Nan::New(PROPERTY_MICROSECONDS),
+              Nan::New<Number>(odbcTime->fraction / 1000));
+  }
+
+  return scope.Escape(date);
+}
+
+/*
+ * DaysFromCivil
+ *
+ * Days from 1970-01-01 to a date of the proleptic Gregorian calendar.
+ */
+
+double ODBC::DaysFromCivil(int year, int month, int day)
+{
+  year -= (month <= 2);
+
+  int era = (year >= 0 ? year : year - 399) / 400;
+  int yearOfEra = year - era * 400;
+  int dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+
+  return (double) era * 146097 + dayOfEra - 719468;
+}
+
+/*
+ * GetLocalOffset
+ *
+ * Seconds local time is ahead of UTC at odbcTime, whose fields read as UTC
+ * are localSeconds. mktime is asked once per local hour.
+ */
+
+double ODBC::GetLocalOffset(SQL_TIMESTAMP_STRUCT* odbcTime, double localSeconds)
+{
+  double hour = floor(localSeconds / 3600);
+  LocalOffset *cached = &g_localOffsets[
+    ((long long) hour) & (LOCAL_OFFSET_CACHE_SIZE - 1)];
+
+  if (cached->used && cached->hour == hour) {
+    return cached->offset;
+  }
+
+  struct tm timeInfo;
+  memset(&timeInfo, 0, sizeof(timeInfo));
+
+  timeInfo.tm_year = odbcTime->year - 1900;
+  timeInfo.tm_mon = odbcTime->month - 1;
+  timeInfo.tm_mday = odbcTime->day;
+  timeInfo.tm_hour = odbcTime->hour;
+
+  //a negative value means that mktime() should use timezone information 
+  //and system databases to attempt to determine whether DST is in effect 
+  //at the specified time.
+  timeInfo.tm_isdst = -1;
+
+  cached->used = true;
+  cached->hour = hour;
+  cached->offset = hour * 3600 - (double) mktime(&timeInfo);
+
+  return cached->offset;
+}
+
+/*
+ * SetTimestampZone
+ *
+ * How timestamp fields become Dates: "local", "utc", or a fixed offset in
+ * minutes east of UTC.
+ */
+
+NAN_METHOD(ODBC::SetTimestampZone) {
+  Nan::HandleScope scope;
+
+  if (info.Length() == 1 && info[0]->IsNumber()) {
+    g_timestampZone = TIMESTAMP_OFFSET;
+    g_timestampOffset = info[0]->NumberValue() * 60;
+    return;
+  }
+
+  if (info.Length() == 1 && info[0]->IsString()) {
+    String::Utf8Value zone(info[0]->ToString());
+
+    if (strcmp(*zone, "utc") == 0 || strcmp(*zone, "UTC") == 0) {
+      g_timestampZone = TIMESTAMP_UTC;
+      return;
+    }
+
+    if (strcmp(*zone, "local") == 0) {
+      //TZ may have changed since the offsets were cached
+      memset(g_localOffsets, 0, sizeof(g_localOffsets));
+      g_timestampZone = TIMESTAMP_LOCAL;
+      return;
+    }
+  }
+
+  return Nan::ThrowTypeError("setTimestampZone(): zone must be \"local\", "
+                             "\"utc\" or an offset in minutes east of UTC.");
+}
+
 /*
  * GetOutputParameter
+ *
+ * A binary output parameter is copied into the returned Buffer, since its
+ * value lives in the block of the bind that FREE_PARAMS frees as a whole.
  */
 
-Handle<Value> ODBC::GetOutputParameter( Parameter prm ) 
+Handle<Value> ODBC::GetOutputParameter( Parameter &prm ) 
 {
   Nan::EscapableHandleScope scope;
   Local<String> str;
@@ -744,14 +1120,19 @@ Handle<Value> ODBC::GetOutputParameter( Parameter prm )
           return scope.Escape(Nan::Null());
       }
       if(prm.c_type == SQL_C_BINARY)
-          str = Nan::NewOneByteString((uint8_t *) prm.buffer, prm.length).ToLocalChecked();
-      else {
-        #ifdef UNICODE
-        str = Nan::New((uint16_t *) prm.buffer).ToLocalChecked();
-        #else
-        str = Nan::New((char *) prm.buffer).ToLocalChecked();
-        #endif
+      {
+          //the driver reports the full length (or SQL_NO_TOTAL) when the
+          //value was truncated
+          SQLLEN len = (prm.length < 0 || prm.length > prm.buffer_length)
+                       ? prm.buffer_length : prm.length;
+          Local<Object> buf = Nan::CopyBuffer((char *) prm.buffer, len).ToLocalChecked();
+          return scope.Escape(buf);
       }
+      #ifdef UNICODE
+      str = GetWideValue((uint16_t *) prm.buffer);
+      #else
+      str = Nan::New((char *) prm.buffer).ToLocalChecked();
+      #endif
       return scope.Escape(str);
   }
 }
@@ -762,148 +1143,2551 @@ Handle<Value> ODBC::GetOutputParameter( Parameter prm )
 
 Local<Object> ODBC::GetRecordTuple ( SQLHSTMT hStmt, Column* columns, 
                                          short* colCount, uint16_t* buffer,
-                                         int bufferLength) {
+                                         int bufferLength, RowShape* shape) {
   Nan::EscapableHandleScope scope;
   
-  Local<Object> tuple = Nan::New<Object>();
+  Local<Object> tuple = Nan::NewInstance(Nan::New(shape->tmpl)).ToLocalChecked();
         
   for(int i = 0; i < *colCount; i++) {
-#ifdef UNICODE
-    tuple->Set( Nan::New((uint16_t *) columns[i].name).ToLocalChecked(),
-                GetColumnValue( hStmt, columns[i], buffer, bufferLength));
-#else
-    tuple->Set( Nan::New((const char *) columns[i].name).ToLocalChecked(),
+    tuple->Set( Nan::New(shape->keys[i]),
                 GetColumnValue( hStmt, columns[i], buffer, bufferLength));
-#endif
   }
   
   return scope.Escape(tuple);
 }
 
 /*
- * GetRecordArray
+ * NewRowShape
+ *
+ * Creates the column name keys once per result set, and a template with a
+ * property for each of them so that filling in a row object never has to
+ * add properties.
  */
 
-Local<Value> ODBC::GetRecordArray ( SQLHSTMT hStmt, Column* columns, 
-                                         short* colCount, uint16_t* buffer,
-                                         int bufferLength) {
-  Nan::EscapableHandleScope scope;
-  
-  Local<Array> array = Nan::New<Array>();
-        
-  for(int i = 0; i < *colCount; i++) {
-    array->Set( Nan::New(i),
-                GetColumnValue( hStmt, columns[i], buffer, bufferLength));
+RowShape* ODBC::NewRowShape(Column* columns, short colCount) {
+  Nan::HandleScope scope;
+
+  RowShape *shape = new RowShape;
+  Local<ObjectTemplate> tmpl = Nan::New<ObjectTemplate>();
+
+  shape->colCount = colCount;
+  shape->keys = new Nan::Persistent<String>[colCount];
+
+  for (int i = 0; i < colCount; i++) {
+    Local<String> key = NewColumnKey(&columns[i]);
+    bool duplicate = false;
+
+    shape->keys[i].Reset(key);
+
+    //a later column with the same name overwrites the value, as before
+    for (int j = 0; j < i && !duplicate; j++) {
+      duplicate = Nan::New(shape->keys[j])->StrictEquals(key);
+    }
+
+    if (!duplicate) {
+      tmpl->Set(key, Nan::Undefined());
+    }
   }
-  
-  return scope.Escape(array);
+
+  shape->tmpl.Reset(tmpl);
+
+  return shape;
 }
 
 /*
- * GetParametersFromArray
+ * NewColumnKey
+ *
+ * Internalized, so that setting a property does not have to look the
+ * string up in the string table first.
  */
 
-Parameter* ODBC::GetParametersFromArray (Local<Array> values, int *paramCount) {
-  DEBUG_PRINTF("ODBC::GetParametersFromArray\n");
-  *paramCount = values->Length();
-  
-  Parameter* params = (Parameter *) malloc(*paramCount * sizeof(Parameter));
-  if( !params ) {
-      Nan::LowMemoryNotification();
-      Nan::ThrowError("Could not allocate enough memory for params in ODBC::GetParametersFromArray.");
-      return params;
-  }
-  memset(params, '\0', *paramCount * sizeof(Parameter));
+Local<String> ODBC::NewColumnKey(Column* column) {
+  Nan::EscapableHandleScope scope;
 
-  for (int i = 0; i < *paramCount; i++) {
-    Local<Value> value = values->Get(i);
-    
-    params[i].paramtype     = SQL_PARAM_INPUT;
-    params[i].size          = 0;
-    params[i].length        = SQL_NULL_DATA;
-    params[i].buffer_length = 0;
-    params[i].decimals      = 0;
+#if (NODE_MODULE_VERSION >= NODE_4_0_MODULE_VERSION)
+#ifdef UNICODE
+  return scope.Escape(String::NewFromTwoByte(Isolate::GetCurrent(),
+                                             (const uint16_t *) column->name,
+                                             NewStringType::kInternalized)
+                        .ToLocalChecked());
+#else
+  return scope.Escape(String::NewFromUtf8(Isolate::GetCurrent(),
+                                          (const char *) column->name,
+                                          NewStringType::kInternalized)
+                        .ToLocalChecked());
+#endif
+#else
+#ifdef UNICODE
+  return scope.Escape(Nan::New((uint16_t *) column->name).ToLocalChecked());
+#else
+  return scope.Escape(Nan::New((const char *) column->name).ToLocalChecked());
+#endif
+#endif
+}
 
-    DEBUG_PRINTF("ODBC::GetParametersFromArray - &param[%i].length = %p\n",
-                 i, &params[i].length);
+/*
+ * FreeRowShape
+ */
 
-    if (value->IsArray()) 
-    {
-      Local<Value> val;
-      Local<Array> paramArray = Local<Array>::Cast(value);
-      int arrlen = paramArray->Length();
-      if(arrlen < 4)
-      {
-          DEBUG_PRINTF("ODBC::GetParametersFromArray - arrlen = %i\n", arrlen);
-          Nan::ThrowError("Wrong param format!");
-          return params;
-      }
+void ODBC::FreeRowShape(RowShape* shape) {
+  if (shape == NULL) {
+    return;
+  }
 
-      val =  paramArray->Get(0); 
-      if(val->IsInt32())
-          params[i].paramtype = val->IntegerValue();
+  for (int i = 0; i < shape->colCount; i++) {
+    shape->keys[i].Reset();
+  }
 
-      val =  paramArray->Get(1); 
-      if(val->IsInt32())
-          params[i].c_type = val->IntegerValue();
-      else
-          params[i].c_type = SQL_C_CHAR;
+  delete [] shape->keys;
+  shape->tmpl.Reset();
+  shape->lazyTmpl.Reset();
+  delete shape;
+}
+
+/*
+ * NewShapeCache
+ *
+ * An empty cache holding one reference, for the statement that creates it.
+ * Returns NULL when out of memory; results then describe their own columns.
+ */
+
+ShapeCache* ODBC::NewShapeCache() {
+  ShapeCache* cache = (ShapeCache *) calloc(1, sizeof(ShapeCache));
+
+  if (cache) {
+    cache->refs = 1;
+  }
+
+  return cache;
+}
+
+/*
+ * ReleaseShapeCache
+ *
+ * Drops a reference and frees the cache with the last one. The row shape
+ * holds persistent handles, so this must run on the loop thread.
+ */
+
+void ODBC::ReleaseShapeCache(ShapeCache* cache) {
+  if (cache == NULL || --cache->refs > 0) {
+    return;
+  }
+
+  if (cache->columns) {
+    FreeColumns(cache->columns, &cache->colCount);
+  }
+
+  FreeRowShape(cache->shape);
+  free(cache);
+}
+
+/*
+ * GetCachedStatement
+ *
+ * Finds an idle statement prepared from the same SQL text, moves it to the
+ * front of the cache and marks it busy, counting a hit. Returns NULL when
+ * there is none, a miss unless the cache is disabled.
+ */
+
+CachedStatement* ODBC::GetCachedStatement(StatementCache* cache, void* sql,
+                                          int sqlSize) {
+  CachedStatement* stmt = cache->head;
+
+  while (stmt && (stmt->busy || stmt->sqlSize != sqlSize ||
+                  memcmp(stmt->sql, sql, sqlSize) != 0)) {
+    stmt = stmt->next;
+  }
+
+  if (stmt == NULL) {
+    if (cache->capacity > 0) {
+      cache->misses++;
+    }
+
+    return NULL;
+  }
+
+  cache->hits++;
+
+  if (stmt != cache->head) {
+    stmt->prev->next = stmt->next;
+
+    if (stmt->next) {
+      stmt->next->prev = stmt->prev;
+    }
+    else {
+      cache->tail = stmt->prev;
+    }
+
+    stmt->prev = NULL;
+    stmt->next = cache->head;
+    cache->head->prev = stmt;
+    cache->head = stmt;
+  }
+
+  stmt->busy = true;
+
+  return stmt;
+}
+
+/*
+ * AddCachedStatement
+ *
+ * Puts a statement just prepared from sql at the front of the cache, busy,
+ * and evicts the least recently used ones beyond the capacity. Returns NULL
+ * when the cache is disabled or out of memory; the caller then keeps the
+ * handle to itself.
+ */
+
+CachedStatement* ODBC::AddCachedStatement(StatementCache* cache,
+                                          StatementPool* pool,
+                                          SQLHSTMT hStmt, void* sql,
+                                          int sqlSize) {
+  if (cache->capacity <= 0) {
+    return NULL;
+  }
+
+  CachedStatement* stmt =
+    (CachedStatement *) calloc(1, sizeof(CachedStatement));
+
+  if (stmt == NULL) {
+    return NULL;
+  }
+
+  stmt->sql = malloc(sqlSize);
+
+  if (stmt->sql == NULL) {
+    free(stmt);
+    return NULL;
+  }
+
+  memcpy(stmt->sql, sql, sqlSize);
+  stmt->sqlSize = sqlSize;
+  stmt->hSTMT = hStmt;
+  stmt->pool = pool;
+  stmt->busy = true;
+  stmt->shapeCache = NewShapeCache();
+
+  stmt->next = cache->head;
+
+  if (cache->head) {
+    cache->head->prev = stmt;
+  }
+  else {
+    cache->tail = stmt;
+  }
+
+  cache->head = stmt;
+  cache->count++;
+
+  ResizeStatementCache(cache, cache->capacity);
+
+  return stmt;
+}
+
+/*
+ * ReleaseCachedStatement
+ *
+ * Called when the result reading from a busy statement is done with it.
+ * Closes the cursor and unbinds the parameters, whose buffers are about to
+ * be freed, but keeps the statement prepared.
+ */
+
+void ODBC::ReleaseCachedStatement(CachedStatement* stmt) {
+  stmt->busy = false;
+
+  if (stmt->evicted) {
+    FreeCachedStatement(stmt);
+    return;
+  }
+
+  SQLFreeStmt(stmt->hSTMT, SQL_CLOSE);
+  SQLFreeStmt(stmt->hSTMT, SQL_RESET_PARAMS);
+}
+
+/*
+ * ResizeStatementCache
+ *
+ * Sets the capacity and evicts the least recently used statements beyond
+ * it. Busy ones are freed when their result is done with them. A capacity
+ * of 0 empties the cache, as a connection does before it disconnects.
+ */
+
+void ODBC::ResizeStatementCache(StatementCache* cache, int capacity) {
+  cache->capacity = capacity > 0 ? capacity : 0;
+
+  while (cache->count > cache->capacity) {
+    CachedStatement* stmt = cache->tail;
+
+    cache->tail = stmt->prev;
+
+    if (cache->tail) {
+      cache->tail->next = NULL;
+    }
+    else {
+      cache->head = NULL;
+    }
+
+    cache->count--;
+    stmt->prev = NULL;
+    stmt->evicted = true;
+
+    if (!stmt->busy) {
+      FreeCachedStatement(stmt);
+    }
+  }
+}
+
+/*
+ * FreeCachedStatement
+ */
+
+void ODBC::FreeCachedStatement(CachedStatement* stmt) {
+  ReleasePooledStatement(stmt->pool, stmt->hSTMT);
+  ReleaseShapeCache(stmt->shapeCache);
+  free(stmt->sql);
+  free(stmt);
+}
+
+/*
+ * NewStatementPool
+ *
+ * Returns NULL when out of memory; the connection then allocates and frees
+ * its statement handles as they are needed.
+ */
+
+StatementPool* ODBC::NewStatementPool(int capacity) {
+  StatementPool* pool = (StatementPool *) calloc(1, sizeof(StatementPool));
+
+  if (pool == NULL) {
+    return NULL;
+  }
+
+  ResizeStatementPool(pool, capacity);
+
+  return pool;
+}
+
+/*
+ * TakePooledStatement
+ *
+ * Counts a handle as in use and returns an idle one, or NULL when the pool
+ * has none; the caller then allocates the handle itself, possibly on the
+ * thread pool. Either way the handle goes back with ReleasePooledStatement.
+ */
+
+SQLHSTMT ODBC::TakePooledStatement(StatementPool* pool) {
+  if (pool == NULL) {
+    return (SQLHSTMT)NULL;
+  }
+
+  if (++pool->inUse > pool->highWater) {
+    pool->highWater = pool->inUse;
+  }
+
+  if (pool->count == 0) {
+    pool->allocated++;
+    return (SQLHSTMT)NULL;
+  }
+
+  pool->reused++;
+
+  return pool->handles[--pool->count];
+}
+
+/*
+ * ReleasePooledStatement
+ *
+ * Resets a handle taken with TakePooledStatement and keeps it, or frees it
+ * when the pool is full or closed. Without a pool it just frees the handle.
+ */
+
+void ODBC::ReleasePooledStatement(StatementPool* pool, SQLHSTMT hStmt) {
+  if (pool == NULL) {
+    SQLFreeHandle(SQL_HANDLE_STMT, hStmt);
+    return;
+  }
+
+  pool->inUse--;
+
+  if (hStmt && !pool->closed && pool->count < pool->capacity &&
+      SQL_SUCCEEDED(SQLFreeStmt(hStmt, SQL_CLOSE))) {
+    SQLFreeStmt(hStmt, SQL_UNBIND);
+    SQLFreeStmt(hStmt, SQL_RESET_PARAMS);
+    pool->handles[pool->count++] = hStmt;
+    return;
+  }
+
+  if (hStmt) {
+    SQLFreeHandle(SQL_HANDLE_STMT, hStmt);
+  }
+
+  if (pool->closed && pool->inUse == 0) {
+    free(pool->handles);
+    free(pool);
+  }
+}
+
+/*
+ * ResizeStatementPool
+ *
+ * Sets how many idle handles the pool keeps, freeing those beyond it.
+ */
+
+void ODBC::ResizeStatementPool(StatementPool* pool, int capacity) {
+  if (capacity < 0) {
+    capacity = 0;
+  }
+
+  while (pool->count > capacity) {
+    SQLFreeHandle(SQL_HANDLE_STMT, pool->handles[--pool->count]);
+  }
+
+  SQLHSTMT* handles = (SQLHSTMT *) realloc(pool->handles,
+                                           (capacity + 1) * sizeof(SQLHSTMT));
+
+  //keep the old array, and capacity, if it cannot grow
+  if (handles) {
+    pool->handles = handles;
+    pool->capacity = capacity;
+  }
+}
+
+/*
+ * CloseStatementPool
+ *
+ * Frees the idle handles of a connection that is going away. Handles still
+ * in use are freed as they come back, and the pool with the last of them.
+ */
+
+void ODBC::CloseStatementPool(StatementPool* pool) {
+  if (pool == NULL) {
+    return;
+  }
+
+  ResizeStatementPool(pool, 0);
+  pool->closed = true;
+
+  if (pool->inUse == 0) {
+    free(pool->handles);
+    free(pool);
+  }
+}
+
+/*
+ * GetRecordArray
+ */
+
+Local<Value> ODBC::GetRecordArray ( SQLHSTMT hStmt, Column* columns, 
+                                         short* colCount, uint16_t* buffer,
+                                         int bufferLength) {
+  Nan::EscapableHandleScope scope;
+  
+  Local<Array> array = Nan::New<Array>();
+        
+  for(int i = 0; i < *colCount; i++) {
+    array->Set( Nan::New(i),
+                GetColumnValue( hStmt, columns[i], buffer, bufferLength));
+  }
+  
+  return scope.Escape(array);
+}
+
+/*
+ * BindRowBlock
+ *
+ * Binds every column of the current result set row-wise into one buffer so
+ * that a single SQLFetchScroll returns a whole block of rows. Returns NULL
+ * when the result set has to be fetched row by row instead: it has a LOB
+ * column, a column without a usable display or octet length, or rows wider
+ * than MAX_BLOCK_ROW_SIZE. The buffer starts out with room for one block and
+ * FetchRowBlock grows it up to fetchSize rows, so several blocks can be
+ * fetched into it before the rows are handed back to V8 without a one row
+ * lookup paying for the whole of it.
+ * BIGINT and DECIMAL columns are bound as SetNumericTypes chose.
+ * Does not touch V8, so it may run on the thread pool.
+ */
+
+RowBlock* ODBC::BindRowBlock(SQLHSTMT hStmt, Column* columns, short colCount,
+                             int fetchSize) {
+  SQLRETURN ret;
+  SQLLEN rowSize = 0;
+
+  if (colCount <= 0) {
+    return NULL;
+  }
+
+  BoundColumn *bound = new BoundColumn[colCount];
+
+  for (int i = 0; i < colCount; i++) {
+    bound[i].index = columns[i].index;
+    
+    switch ((int) columns[i].type) {
+      case SQL_INTEGER :
+      case SQL_SMALLINT :
+      case SQL_TINYINT :
+        bound[i].c_type = SQL_C_SLONG;
+        bound[i].width = sizeof(SQLINTEGER);
+        break;
+
+      case SQL_FLOAT :
+      case SQL_REAL :
+      case SQL_DOUBLE :
+        bound[i].c_type = SQL_C_DOUBLE;
+        bound[i].width = sizeof(double);
+        break;
+
+      case SQL_DATETIME :
+      case SQL_TIMESTAMP :
+        bound[i].c_type = SQL_C_TYPE_TIMESTAMP;
+        bound[i].width = sizeof(SQL_TIMESTAMP_STRUCT);
+        break;
+
+      case SQL_BIT :
+        bound[i].c_type = SQL_C_BIT;
+        bound[i].width = sizeof(SQLCHAR);
+        break;
+
+      case SQL_BINARY :
+      case SQL_VARBINARY :
+        if (columns[i].octetLength <= 0 ||
+            columns[i].octetLength >= MAX_BLOCK_ROW_SIZE) {
+          delete [] bound;
+          return NULL;
+        }
+        bound[i].c_type = SQL_C_BINARY;
+        bound[i].width = columns[i].octetLength;
+        break;
+
+      case SQL_BLOB :
+      case SQL_CLOB :
+      case SQL_DBCLOB :
+      case SQL_XML :
+      case SQL_LONGVARCHAR :
+      case SQL_WLONGVARCHAR :
+      case SQL_LONGVARBINARY :
+        DEBUG_PRINTF("ODBC::BindRowBlock - LOB column %i, fetching by row\n",
+                     columns[i].index);
+        delete [] bound;
+        return NULL;
+
+      default :
+        //BIGINT and DECIMAL as chosen by SetNumericTypes
+        if (columns[i].c_type == SQL_C_SBIGINT) {
+          bound[i].c_type = SQL_C_SBIGINT;
+          bound[i].width = sizeof(SQLBIGINT);
+          break;
+        }
+        if (columns[i].c_type == SQL_C_DOUBLE) {
+          bound[i].c_type = SQL_C_DOUBLE;
+          bound[i].width = sizeof(double);
+          break;
+        }
+        if (columns[i].displaySize <= 0 ||
+            columns[i].displaySize >= MAX_BLOCK_ROW_SIZE) {
+          delete [] bound;
+          return NULL;
+        }
+        if (columns[i].c_type == SQL_C_CHAR) {
+          bound[i].c_type = SQL_C_CHAR;
+          bound[i].width = columns[i].displaySize * UTF8_CHAR_SIZE + 1;
+          break;
+        }
+        bound[i].c_type = SQL_C_TCHAR;
+        bound[i].width = (columns[i].displaySize + 1) * sizeof(SQLTCHAR);
+        break;
+    }
+
+    bound[i].offset = rowSize;
+    rowSize += sizeof(SQLLEN) + ALIGN_SQLLEN(bound[i].width);
+  }
+
+  if (rowSize > MAX_BLOCK_ROW_SIZE) {
+    DEBUG_PRINTF("ODBC::BindRowBlock - rowSize=%i, fetching by row\n", rowSize);
+    delete [] bound;
+    return NULL;
+  }
+
+  RowBlock *block = new RowBlock;
+  block->columns = bound;
+  block->colCount = colCount;
+  block->rowSize = rowSize;
+  block->rowArraySize = MAX_BLOCK_SIZE / rowSize;
+  block->rowCapacity = MAX_FETCH_BUFFER_SIZE / rowSize;
+  block->rowsFetched = 0;
+  block->bindOffset = 0;
+  block->rowCount = 0;
+
+  if (fetchSize < 1) {
+    fetchSize = 1;
+  }
+
+  block->fetchSize = fetchSize;
+
+  if (block->rowCapacity > (SQLULEN) fetchSize) {
+    block->rowCapacity = fetchSize;
+  }
+
+  if (block->rowArraySize > FETCH_BLOCK_ROWS) {
+    block->rowArraySize = FETCH_BLOCK_ROWS;
+  }
+
+  if (block->rowArraySize > block->rowCapacity) {
+    block->rowArraySize = block->rowCapacity;
+  }
+
+  //every SQLFetchScroll needs room for a whole block
+  block->rowCapacity -= block->rowCapacity % block->rowArraySize;
+
+  block->rowsAllocated = block->rowArraySize;
+  block->buffer = (char *) malloc(block->rowSize * block->rowsAllocated);
+
+  if (!block->buffer) {
+    delete [] bound;
+    delete block;
+    return NULL;
+  }
+
+  ret = SQLSetStmtAttr(hStmt, SQL_ATTR_ROW_BIND_TYPE,
+                       (SQLPOINTER)(intptr_t) block->rowSize, 0);
+
+  if (SQL_SUCCEEDED(ret)) {
+    ret = SQLSetStmtAttr(hStmt, SQL_ATTR_ROW_ARRAY_SIZE,
+                         (SQLPOINTER)(intptr_t) block->rowArraySize, 0);
+  }
+
+  if (SQL_SUCCEEDED(ret)) {
+    ret = SQLSetStmtAttr(hStmt, SQL_ATTR_ROWS_FETCHED_PTR,
+                         &block->rowsFetched, 0);
+  }
+
+  if (SQL_SUCCEEDED(ret)) {
+    ret = SQLSetStmtAttr(hStmt, SQL_ATTR_ROW_BIND_OFFSET_PTR,
+                         &block->bindOffset, 0);
+  }
+
+  if (SQL_SUCCEEDED(ret)) {
+    ret = BindRowBlockColumns(hStmt, block);
+  }
+
+  if (!SQL_SUCCEEDED(ret)) {
+    DEBUG_PRINTF("ODBC::BindRowBlock - bind failed, ret=%i\n", ret);
+    FreeRowBlock(hStmt, block);
+    return NULL;
+  }
+
+  DEBUG_PRINTF("ODBC::BindRowBlock - colCount=%i rowSize=%i rowArraySize=%i "
+               "rowCapacity=%i\n", colCount, block->rowSize,
+               block->rowArraySize, block->rowCapacity);
+
+  return block;
+}
+
+/*
+ * BindRowBlockColumns
+ *
+ * Binds the columns of a block where its buffer is now, after BindRowBlock
+ * allocated it or FetchRowBlock moved it.
+ */
+
+SQLRETURN ODBC::BindRowBlockColumns(SQLHSTMT hStmt, RowBlock* block) {
+  SQLRETURN ret = SQL_SUCCESS;
+  
+  for (int i = 0; i < block->colCount && SQL_SUCCEEDED(ret); i++) {
+    BoundColumn *bound = &block->columns[i];
+    
+    ret = SQLBindCol( hStmt,
+                      bound->index,
+                      bound->c_type,
+                      block->buffer + bound->offset + sizeof(SQLLEN),
+                      bound->width,
+                      (SQLLEN *) (block->buffer + bound->offset));
+  }
+  
+  return ret;
+}
+
+/*
+ * FetchRowBlock
+ *
+ * Fetches blocks into the buffer, moving the bind offset past the rows
+ * already buffered, until it is full or the result set ends. The buffer is
+ * doubled, up to rowCapacity rows, when the next block does not fit; if
+ * there is no memory for that, the rows buffered so far are returned.
+ * rowCount is the number of rows buffered. Returns SQL_NO_DATA once the end
+ * of the result set has been reached, even when rows were buffered on the
+ * way; on SQL_ERROR the rows buffered before the error are kept as well.
+ */
+
+SQLRETURN ODBC::FetchRowBlock(SQLHSTMT hStmt, RowBlock* block) {
+  SQLRETURN ret;
+
+  block->rowCount = 0;
+
+  while (true) {
+    if (block->rowCount + block->rowArraySize > block->rowsAllocated) {
+      SQLULEN rows = block->rowsAllocated * 2;
+      
+      if (rows > block->rowCapacity) {
+        rows = block->rowCapacity;
+      }
+      
+      char *buffer = (char *) realloc(block->buffer, block->rowSize * rows);
+      
+      if (!buffer) {
+        ret = SQL_SUCCESS;
+        break;
+      }
+      
+      block->buffer = buffer;
+      block->rowsAllocated = rows;
+      ret = BindRowBlockColumns(hStmt, block);
+      
+      if (!SQL_SUCCEEDED(ret)) {
+        break;
+      }
+    }
+    
+    block->bindOffset = block->rowCount * block->rowSize;
+
+    //some drivers only write 32 bits through SQL_ATTR_ROWS_FETCHED_PTR
+    block->rowsFetched = 0;
+
+    ret = SQLFetchScroll(hStmt, SQL_FETCH_NEXT, 0);
+
+    if (!SQL_SUCCEEDED(ret)) {
+      break;
+    }
+
+    block->rowCount += block->rowsFetched;
+
+    //a short block is the last one of the result set
+    if (block->rowsFetched < block->rowArraySize) {
+      ret = SQL_NO_DATA;
+      break;
+    }
+
+    if (block->rowCount + block->rowArraySize > block->rowCapacity) {
+      break;
+    }
+  }
+
+  block->bindOffset = 0;
+
+  return ret;
+}
+
+/*
+ * FreeRowBlock
+ *
+ * Unbinds the columns and restores single row fetching on the statement,
+ * which may be executed again or have more result sets.
+ */
+
+void ODBC::FreeRowBlock(SQLHSTMT hStmt, RowBlock* block) {
+  if (block == NULL) {
+    return;
+  }
+
+  if (hStmt) {
+    SQLFreeStmt(hStmt, SQL_UNBIND);
+    SQLSetStmtAttr(hStmt, SQL_ATTR_ROWS_FETCHED_PTR, NULL, 0);
+    SQLSetStmtAttr(hStmt, SQL_ATTR_ROW_BIND_OFFSET_PTR, NULL, 0);
+    SQLSetStmtAttr(hStmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER) 1, 0);
+    SQLSetStmtAttr(hStmt, SQL_ATTR_ROW_BIND_TYPE, 
+                   (SQLPOINTER) SQL_BIND_BY_COLUMN, 0);
+  }
+
+  free(block->buffer);
+  delete [] block->columns;
+  delete block;
+}
+
+/*
+ * GetBoundColumnValue
+ */
+
+Handle<Value> ODBC::GetBoundColumnValue(BoundColumn* bound, char* row) {
+  Nan::EscapableHandleScope scope;
+
+  SQLLEN len = *(SQLLEN *) (row + bound->offset);
+  char *value = row + bound->offset + sizeof(SQLLEN);
+
+  //a truncated value reports its full length; keep what we have
+  if (bound->c_type == SQL_C_TCHAR && (len == SQL_NO_TOTAL ||
+      len > bound->width - (SQLLEN) sizeof(SQLTCHAR))) {
+    len = bound->width - sizeof(SQLTCHAR);
+  }
+  else if (bound->c_type == SQL_C_CHAR && (len == SQL_NO_TOTAL ||
+           len > bound->width - 1)) {
+    len = bound->width - 1;
+  }
+  else if (bound->c_type == SQL_C_BINARY && (len == SQL_NO_TOTAL ||
+           len > bound->width)) {
+    len = bound->width;
+  }
+
+  return scope.Escape(GetCellValue(bound->c_type, len, value));
+}
+
+/*
+ * GetCellValue
+ *
+ * Builds the JavaScript value for len bytes of c_type data that have
+ * already been read from the driver.
+ */
+
+Handle<Value> ODBC::GetCellValue(SQLSMALLINT c_type, SQLLEN len, char* value) {
+  Nan::EscapableHandleScope scope;
+
+  if (len == SQL_NULL_DATA) {
+    return scope.Escape(Nan::Null());
+  }
+
+  switch (c_type) {
+    case SQL_C_SLONG :
+      return scope.Escape(Nan::New<Number>(*(SQLINTEGER *) value));
+
+    case SQL_C_DOUBLE :
+      return scope.Escape(Nan::New<Number>(*(double *) value));
+
+#ifdef HAVE_BIGINT
+    case SQL_C_SBIGINT :
+      return scope.Escape(BigInt::New(Isolate::GetCurrent(),
+                                      *(SQLBIGINT *) value));
+#endif
+
+    case SQL_C_TYPE_TIMESTAMP :
+      return scope.Escape(GetTimestampValue((SQL_TIMESTAMP_STRUCT *) value));
+
+    case SQL_C_BIT :
+      return scope.Escape(Nan::New(*(SQLCHAR *) value ? true : false));
+
+    case SQL_C_BINARY :
+      return scope.Escape(Nan::CopyBuffer(value, len).ToLocalChecked());
+
+    case SQL_C_DBCHAR :
+      return scope.Escape(GetWideValue((uint16_t *) value,
+                                       len / sizeof(uint16_t)));
+
+#ifdef UNICODE
+    case SQL_C_CHAR :
+      return scope.Escape(GetUtf8Value(value, len));
+#endif
+
+    default :
+#ifdef UNICODE
+      return scope.Escape(GetWideValue((uint16_t *) value,
+                                       len / sizeof(uint16_t)));
+#else
+      return scope.Escape(GetUtf8Value(value, len));
+#endif
+  }
+}
+
+/*
+ * GetUtf8Value
+ *
+ * String for len bytes of UTF-8. ASCII, which most values are, is copied
+ * into a one-byte string as is instead of being decoded.
+ */
+
+Local<String> ODBC::GetUtf8Value(const char* value, size_t len) {
+  Nan::EscapableHandleScope scope;
+
+  if (IsAscii(value, len)) {
+    return scope.Escape(Nan::NewOneByteString((const uint8_t *) value,
+                                              (int) len).ToLocalChecked());
+  }
+
+  return scope.Escape(Nan::New(value, (int) len).ToLocalChecked());
+}
+
+/*
+ * GetWideValue
+ *
+ * String for len UTF-16 code units. Values with every unit below 256, which
+ * most are, become one-byte strings: they are narrowed while they are
+ * checked, eight units at a time, and the narrowing is dropped at the first
+ * unit that does not fit.
+ */
+
+Local<String> ODBC::GetWideValue(const uint16_t* value, size_t len) {
+  Nan::EscapableHandleScope scope;
+  const uint64_t high = 0xFF00FF00FF00FF00ULL;
+  uint8_t stackBuffer[MAX_NARROW_STACK_SIZE];
+  uint8_t *narrow = stackBuffer;
+  size_t i = 0;
+
+  if (len > MAX_NARROW_STACK_SIZE) {
+    narrow = (uint8_t *) malloc(len);
+  }
+
+  if (narrow == NULL) {
+    return scope.Escape(Nan::New(value, (int) len).ToLocalChecked());
+  }
+
+  //each 16 bit lane holds one unit whatever the byte order
+  for (; i + 8 <= len; i += 8) {
+    uint64_t w[2];
+    memcpy(w, value + i, sizeof(w));
+    if ((w[0] | w[1]) & high) {
+      break;
+    }
+    for (int j = 0; j < 8; j++) {
+      narrow[i + j] = (uint8_t) value[i + j];
+    }
+  }
+
+  for (; i < len && value[i] < 256; i++) {
+    narrow[i] = (uint8_t) value[i];
+  }
+
+  Local<String> str;
+
+  if (i == len) {
+    str = Nan::NewOneByteString(narrow, (int) len).ToLocalChecked();
+  }
+  else {
+    str = Nan::New(value, (int) len).ToLocalChecked();
+  }
+
+  if (narrow != stackBuffer) {
+    free(narrow);
+  }
+
+  return scope.Escape(str);
+}
+
+/*
+ * GetWideValue
+ *
+ * As above for a NUL terminated value.
+ */
+
+Local<String> ODBC::GetWideValue(const uint16_t* value) {
+  size_t len = 0;
+
+  while (value[len]) {
+    len++;
+  }
+
+  return GetWideValue(value, len);
+}
+
+/*
+ * IsAscii
+ *
+ * Whether none of the len bytes has its high bit set, tested a word at a
+ * time with the word loop unrolled so the compiler can vectorize it.
+ */
+
+bool ODBC::IsAscii(const char* value, size_t len) {
+  const uint64_t high = 0x8080808080808080ULL;
+  size_t i = 0;
+
+  //memcpy is a plain unaligned load on the targets that allow one
+  for (; i + 32 <= len; i += 32) {
+    uint64_t w[4];
+    memcpy(w, value + i, sizeof(w));
+    if ((w[0] | w[1] | w[2] | w[3]) & high) {
+      return false;
+    }
+  }
+
+  for (; i + 8 <= len; i += 8) {
+    uint64_t w;
+    memcpy(&w, value + i, sizeof(w));
+    if (w & high) {
+      return false;
+    }
+  }
+
+  for (; i < len; i++) {
+    if ((unsigned char) value[i] & 0x80) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/*
+ * GetBlockRecordTuple
+ */
+
+Local<Object> ODBC::GetBlockRecordTuple ( RowBlock* block, RowShape* shape,
+                                          SQLULEN row) {
+  Nan::EscapableHandleScope scope;
+
+  Local<Object> tuple = Nan::NewInstance(Nan::New(shape->tmpl)).ToLocalChecked();
+  char *rowData = block->buffer + (row * block->rowSize);
+
+  for(int i = 0; i < block->colCount; i++) {
+    tuple->Set( Nan::New(shape->keys[i]),
+                GetBoundColumnValue( &block->columns[i], rowData));
+  }
+
+  return scope.Escape(tuple);
+}
+
+/*
+ * NewLazyBlock
+ *
+ * Copies the rows buffered in the block, with their layout, into a Buffer
+ * for lazy row objects, so the block can be fetched into again. Returns an
+ * empty handle when the copy can not be allocated.
+ */
+
+Local<Object> ODBC::NewLazyBlock(RowBlock* block) {
+  Nan::EscapableHandleScope scope;
+
+  size_t header = ALIGN_SQLLEN(sizeof(LazyBlock));
+  size_t layout = ALIGN_SQLLEN(block->colCount * sizeof(BoundColumn));
+  size_t rows = block->rowCount * block->rowSize;
+  char *data = (char *) malloc(header + layout + rows);
+
+  if (!data) {
+    return scope.Escape(Local<Object>());
+  }
+
+  LazyBlock *lazy = (LazyBlock *) data;
+  lazy->colCount = block->colCount;
+  lazy->rowSize = block->rowSize;
+  lazy->rowCount = block->rowCount;
+
+  memcpy(data + header, block->columns, block->colCount * sizeof(BoundColumn));
+  memcpy(data + header + layout, block->buffer, rows);
+
+  //the Buffer takes over data
+  return scope.Escape(Nan::NewBuffer(data, header + layout + rows).ToLocalChecked());
+}
+
+/*
+ * GetLazyRecordTuple
+ *
+ * Row object over one row of a lazy block. Its properties are accessors
+ * that read the column from the block when first used and then replace
+ * themselves with the value.
+ */
+
+Local<Object> ODBC::GetLazyRecordTuple ( Local<Object> lazyBlock,
+                                         RowShape* shape, SQLULEN row) {
+  Nan::EscapableHandleScope scope;
+
+  if (shape->lazyTmpl.IsEmpty()) {
+    Local<ObjectTemplate> tmpl = Nan::New<ObjectTemplate>();
+
+    //the block Buffer and the row number
+    tmpl->SetInternalFieldCount(2);
+
+    for (int i = 0; i < shape->colCount; i++) {
+      Local<String> key = Nan::New(shape->keys[i]);
+      bool duplicate = false;
+
+      //a later column with the same name is the one that is read
+      for (int j = i + 1; j < shape->colCount && !duplicate; j++) {
+        duplicate = Nan::New(shape->keys[j])->StrictEquals(key);
+      }
+
+      if (!duplicate) {
+        Nan::SetAccessor(tmpl, key, GetLazyValue, SetLazyValue, Nan::New(i));
+      }
+    }
+
+    shape->lazyTmpl.Reset(tmpl);
+  }
+
+  Local<Object> tuple = Nan::NewInstance(Nan::New(shape->lazyTmpl)).ToLocalChecked();
+
+  tuple->SetInternalField(0, lazyBlock);
+  tuple->SetInternalField(1, Nan::New((uint32_t) row));
+
+  return scope.Escape(tuple);
+}
+
+/*
+ * GetLazyValue
+ */
+
+NAN_GETTER(ODBC::GetLazyValue) {
+  Nan::HandleScope scope;
+
+  Local<Object> tuple = info.Holder();
+  char *data = node::Buffer::Data(tuple->GetInternalField(0));
+  uint32_t row = tuple->GetInternalField(1)->Uint32Value();
+  int column = info.Data()->Int32Value();
+
+  LazyBlock *lazy = (LazyBlock *) data;
+  BoundColumn *columns = (BoundColumn *) (data + ALIGN_SQLLEN(sizeof(LazyBlock)));
+  char *rows = (char *) columns + ALIGN_SQLLEN(lazy->colCount * sizeof(BoundColumn));
+
+  Local<Value> value = GetBoundColumnValue(&columns[column],
+                                           rows + row * lazy->rowSize);
+
+  //read once; from now on it is a plain property
+  Nan::ForceSet(tuple, property, value);
+
+  info.GetReturnValue().Set(value);
+}
+
+/*
+ * SetLazyValue
+ */
+
+NAN_SETTER(ODBC::SetLazyValue) {
+  Nan::HandleScope scope;
+
+  Nan::ForceSet(info.Holder(), property, value);
+}
+
+/*
+ * GetBlockRecordArray
+ */
+
+Local<Value> ODBC::GetBlockRecordArray ( RowBlock* block, Column* columns,
+                                         SQLULEN row) {
+  Nan::EscapableHandleScope scope;
+
+  Local<Array> array = Nan::New<Array>();
+  char *rowData = block->buffer + (row * block->rowSize);
+
+  for(int i = 0; i < block->colCount; i++) {
+    array->Set( Nan::New(i),
+                GetBoundColumnValue( &block->columns[i], rowData));
+  }
+
+  return scope.Escape(array);
+}
+
+/*
+ * NewRowBuffer
+ *
+ * Picks the C type each column is read as, the same way BindRowBlock does;
+ * the data buffer is allocated by the first FetchRowBuffer and reused. The
+ * columns stream flags, which must be LOBs (see IsStreamableLob), are left
+ * unread for ODBCResult::GetData, binary ones as SQL_C_BINARY and character
+ * ones as SQL_C_WCHAR.
+ */
+
+RowBuffer* ODBC::NewRowBuffer(Column* columns, short colCount,
+                              const bool* stream) {
+  RowBuffer *rows = new RowBuffer;
+
+  rows->c_types = new SQLSMALLINT[colCount];
+  rows->deferred = stream ? new bool[colCount] : NULL;
+  rows->colCount = colCount;
+  rows->data = NULL;
+  rows->size = 0;
+  rows->capacity = 0;
+  rows->rowCount = 0;
+  rows->blobs = NULL;
+  rows->blobCount = 0;
+  rows->blobCapacity = 0;
+  rows->outOfMemory = false;
+
+  for (int i = 0; i < colCount; i++) {
+    switch ((int) columns[i].type) {
+      case SQL_INTEGER :
+      case SQL_SMALLINT :
+      case SQL_TINYINT :
+        rows->c_types[i] = SQL_C_SLONG;
+        break;
+
+      case SQL_FLOAT :
+      case SQL_REAL :
+      case SQL_DOUBLE :
+        rows->c_types[i] = SQL_C_DOUBLE;
+        break;
+
+      case SQL_DATETIME :
+      case SQL_TIMESTAMP :
+        rows->c_types[i] = SQL_C_TYPE_TIMESTAMP;
+        break;
+
+      case SQL_BIT :
+        rows->c_types[i] = SQL_C_BIT;
+        break;
+
+      case SQL_DBCLOB :
+        rows->c_types[i] = SQL_C_DBCHAR;
+        break;
+
+      case SQL_BINARY :
+      case SQL_VARBINARY :
+      case SQL_LONGVARBINARY :
+      case SQL_BLOB :
+        rows->c_types[i] = SQL_C_BINARY;
+        break;
+
+      default :
+        //BIGINT and DECIMAL as chosen by SetNumericTypes
+        rows->c_types[i] = columns[i].c_type ? columns[i].c_type : SQL_C_TCHAR;
+        break;
+    }
+
+    if (!stream) {
+      continue;
+    }
+
+    rows->deferred[i] = stream[i];
+
+    if (stream[i]) {
+      rows->c_types[i] = (columns[i].type == SQL_BLOB ||
+                          columns[i].type == SQL_LONGVARBINARY)
+                         ? SQL_C_BINARY : SQL_C_WCHAR;
+    }
+  }
+
+  return rows;
+}
+
+/*
+ * IsStreamableLob
+ *
+ * True for the columns fetch({ streamLobs }) can leave for GetData.
+ */
+
+bool ODBC::IsStreamableLob(Column* column) {
+  switch ((int) column->type) {
+    case SQL_BLOB :
+    case SQL_LONGVARBINARY :
+    case SQL_CLOB :
+    case SQL_DBCLOB :
+    case SQL_XML :
+    case SQL_LONGVARCHAR :
+    case SQL_WLONGVARCHAR :
+      return true;
+
+    default :
+      return false;
+  }
+}
+
+/*
+ * FetchRowBuffer
+ *
+ * Fetches up to maxRows rows, reading every column with SQLGetData into the
+ * row buffer, until MAX_FETCH_BUFFER_SIZE bytes are buffered. rowCount is
+ * the number of complete rows buffered; like FetchRowBlock it returns
+ * SQL_NO_DATA or SQL_ERROR with the rows buffered before that kept. Does
+ * not touch V8, so it may run on the thread pool.
+ */
+
+SQLRETURN ODBC::FetchRowBuffer(SQLHSTMT hStmt, Column* columns,
+                               RowBuffer* rows, int maxRows) {
+  SQLRETURN ret = SQL_SUCCESS;
+
+  ReleaseBlobs(rows, 0);
+  rows->size = 0;
+  rows->rowCount = 0;
+
+  if (maxRows < 1) {
+    maxRows = 1;
+  }
+
+  while (rows->rowCount < (SQLULEN) maxRows &&
+         rows->size < MAX_FETCH_BUFFER_SIZE) {
+    size_t start = rows->size;
+
+    ret = SQLFetch(hStmt);
+
+    if (!SQL_SUCCEEDED(ret)) {
+      break;
+    }
+
+    for (int i = 0; i < rows->colCount && SQL_SUCCEEDED(ret); i++) {
+      if (rows->deferred && rows->deferred[i]) {
+        ret = GetDeferredCellData(hStmt, columns[i].index, rows->c_types[i], rows);
+      }
+      else {
+        ret = GetCellData(hStmt, &columns[i], rows->c_types[i], rows);
+      }
+    }
+
+    if (!SQL_SUCCEEDED(ret)) {
+      //drop the partly read row
+      ReleaseBlobs(rows, start);
+      rows->size = start;
+      break;
+    }
+
+    rows->rowCount++;
+  }
+
+  return ret;
+}
+
+/*
+ * GetCellData
+ *
+ * Appends one cell to the row buffer. Character values are read in as many
+ * SQLGetData calls as it takes, growing the buffer each time; binary values
+ * are read by GetBinaryData and only their pointer is kept in the cell.
+ */
+
+SQLRETURN ODBC::GetCellData(SQLHSTMT hStmt, Column* column,
+                            SQLSMALLINT c_type, RowBuffer* rows) {
+  SQLUSMALLINT index = column->index;
+  SQLRETURN ret;
+  SQLLEN ind = 0;
+  SQLLEN len = 0;
+  SQLLEN width;
+  SQLLEN terCharLen = 0;
+  bool variable = true;
+
+  switch (c_type) {
+    case SQL_C_SLONG :
+      width = sizeof(SQLINTEGER);
+      variable = false;
+      break;
+
+    case SQL_C_DOUBLE :
+      width = sizeof(double);
+      variable = false;
+      break;
+
+    case SQL_C_SBIGINT :
+      width = sizeof(SQLBIGINT);
+      variable = false;
+      break;
+
+    case SQL_C_TYPE_TIMESTAMP :
+      width = sizeof(SQL_TIMESTAMP_STRUCT);
+      variable = false;
+      break;
+
+    case SQL_C_BIT :
+      width = sizeof(SQLCHAR);
+      variable = false;
+      break;
+
+    case SQL_C_BINARY :
+      {
+        char *value = NULL;
+
+        width = sizeof(SQLLEN) + ALIGN_SQLLEN(sizeof(char *));
+
+        if (!ReserveRowBuffer(rows, width)) {
+          rows->outOfMemory = true;
+          return SQL_ERROR;
+        }
+
+        if (rows->blobCount == rows->blobCapacity) {
+          size_t capacity = rows->blobCapacity ? rows->blobCapacity * 2 : 64;
+          size_t *blobs = (size_t *) realloc(rows->blobs,
+                                             capacity * sizeof(size_t));
+          if (!blobs) {
+            rows->outOfMemory = true;
+            return SQL_ERROR;
+          }
+          rows->blobs = blobs;
+          rows->blobCapacity = capacity;
+        }
+
+        ret = GetBinaryData(hStmt, index, &value, &len, &rows->outOfMemory);
+
+        if (!SQL_SUCCEEDED(ret)) {
+          return ret;
+        }
+
+        *(SQLLEN *) (rows->data + rows->size) = len;
+        *(char **) (rows->data + rows->size + sizeof(SQLLEN)) = value;
+
+        if (value) {
+          rows->blobs[rows->blobCount++] = rows->size;
+        }
+        rows->size += width;
+
+        return SQL_SUCCESS;
+      }
+
+    case SQL_C_DBCHAR :
+      terCharLen = 2;
+      width = MAX_VALUE_SIZE + terCharLen;
+      break;
+
+#ifdef UNICODE
+    case SQL_C_CHAR :
+      terCharLen = 1;
+      width = GetColumnWidth(column) / sizeof(SQLTCHAR) * UTF8_CHAR_SIZE;
+      width = (width > MAX_VALUE_SIZE ? width : MAX_VALUE_SIZE) + terCharLen;
+      break;
+#endif
+
+    default :
+      //described columns are read in one go, the rest in parts
+      terCharLen = sizeof(SQLTCHAR);
+      width = GetColumnWidth(column);
+      width = (width > MAX_VALUE_SIZE ? width : MAX_VALUE_SIZE) + terCharLen;
+      break;
+  }
+
+  while (true) {
+    if (!ReserveRowBuffer(rows, sizeof(SQLLEN) + len + width)) {
+      DEBUG_PRINTF("ODBC::GetCellData - could not allocate %i bytes\n",
+                   sizeof(SQLLEN) + len + width);
+      rows->outOfMemory = true;
+      return SQL_ERROR;
+    }
+
+    ret = SQLGetData( hStmt,
+                      index,
+                      c_type,
+                      rows->data + rows->size + sizeof(SQLLEN) + len,
+                      width,
+                      &ind);
+
+    //nothing left of a value that has been read in parts
+    if (ret == SQL_NO_DATA) {
+      break;
+    }
+
+    if (!SQL_SUCCEEDED(ret)) {
+      DEBUG_PRINTF("ODBC::GetCellData - index=%i c_type=%i ret=%i\n",
+                   index, c_type, ret);
+      return ret;
+    }
+
+    if (ind == SQL_NULL_DATA) {
+      len = SQL_NULL_DATA;
+      break;
+    }
+
+    if (!variable) {
+      len = width;
+      break;
+    }
+
+    if (ret == SQL_SUCCESS || (ind != SQL_NO_TOTAL && ind <= width - terCharLen)) {
+      len += ind;
+      break;
+    }
+
+    //truncated: keep what we got and ask for the rest, or for twice as
+    //much when the driver can not tell how much is left
+    len += width - terCharLen;
+    width = (ind == SQL_NO_TOTAL) ? width * 2 : ind - (width - terCharLen) + terCharLen;
+  }
+
+  *(SQLLEN *) (rows->data + rows->size) = len;
+  rows->size += sizeof(SQLLEN) + (len > 0 ? ALIGN_SQLLEN(len) : 0);
+
+  return SQL_SUCCESS;
+}
+
+/*
+ * GetDeferredCellData
+ *
+ * Appends the cell of a LOB column that is left for ODBCResult::GetData. An
+ * SQLGetData call with no room for data tells NULL apart without taking any
+ * of the value, so the cell is just the length it reports.
+ */
+
+SQLRETURN ODBC::GetDeferredCellData(SQLHSTMT hStmt, SQLUSMALLINT index,
+                                    SQLSMALLINT c_type, RowBuffer* rows) {
+  SQLRETURN ret;
+  SQLLEN ind = 0;
+  SQLWCHAR probe[1];
+
+  if (!ReserveRowBuffer(rows, sizeof(SQLLEN))) {
+    rows->outOfMemory = true;
+    return SQL_ERROR;
+  }
+
+  ret = SQLGetData(hStmt, index, c_type, probe, 0, &ind);
+
+  if (!SQL_SUCCEEDED(ret)) {
+    DEBUG_PRINTF("ODBC::GetDeferredCellData - index=%i c_type=%i ret=%i\n",
+                 index, c_type, ret);
+    return ret;
+  }
+
+  *(SQLLEN *) (rows->data + rows->size) = ind;
+  rows->size += sizeof(SQLLEN);
+
+  return SQL_SUCCESS;
+}
+
+/*
+ * ReserveRowBuffer
+ *
+ * Makes room for bytes more bytes after the ones in use.
+ */
+
+bool ODBC::ReserveRowBuffer(RowBuffer* rows, size_t bytes) {
+  size_t capacity = rows->capacity ? rows->capacity : MAX_FIELD_SIZE * 64;
+
+  if (rows->size + bytes <= rows->capacity) {
+    return true;
+  }
+
+  while (capacity < rows->size + bytes) {
+    capacity *= 2;
+  }
+
+  char *data = (char *) realloc(rows->data, capacity);
+
+  if (!data) {
+    return false;
+  }
+
+  rows->data = data;
+  rows->capacity = capacity;
+
+  return true;
+}
+
+/*
+ * ReleaseBlobs
+ *
+ * Frees the binary values of the cells from offset on that were not handed
+ * to a Buffer, and forgets those cells.
+ */
+
+void ODBC::ReleaseBlobs(RowBuffer* rows, size_t offset) {
+  while (rows->blobCount > 0 && rows->blobs[rows->blobCount - 1] >= offset) {
+    size_t cell = rows->blobs[--rows->blobCount];
+
+    free(*(char **) (rows->data + cell + sizeof(SQLLEN)));
+  }
+}
+
+/*
+ * GetBinaryData
+ *
+ * Reads a whole binary value into memory of its own, in as many SQLGetData
+ * calls as it takes. *data is NULL and *len SQL_NULL_DATA for NULL;
+ * otherwise the caller owns *data. Does not touch V8, so it may run on the
+ * thread pool.
+ */
+
+SQLRETURN ODBC::GetBinaryData(SQLHSTMT hStmt, SQLUSMALLINT index,
+                              char** data, SQLLEN* len, bool* outOfMemory) {
+  SQLRETURN ret;
+  SQLLEN ind = 0;
+  SQLLEN size = MAX_VALUE_SIZE;
+  SQLLEN total = 0;
+  char *buffer = (char *) malloc(size);
+
+  *data = NULL;
+  *len = 0;
+
+  if (!buffer) {
+    *outOfMemory = true;
+    return SQL_ERROR;
+  }
+
+  while (true) {
+    ret = SQLGetData( hStmt,
+                      index,
+                      SQL_C_BINARY,
+                      buffer + total,
+                      size - total,
+                      &ind);
+
+    //nothing left of a value that has been read in parts
+    if (ret == SQL_NO_DATA) {
+      break;
+    }
+
+    if (!SQL_SUCCEEDED(ret)) {
+      DEBUG_PRINTF("ODBC::GetBinaryData - index=%i ret=%i\n", index, ret);
+      free(buffer);
+      return ret;
+    }
+
+    if (ind == SQL_NULL_DATA) {
+      free(buffer);
+      *len = SQL_NULL_DATA;
+      return SQL_SUCCESS;
+    }
+
+    if (ret == SQL_SUCCESS || (ind != SQL_NO_TOTAL && ind <= size - total)) {
+      total += ind;
+      break;
+    }
+
+    //truncated: keep what we got and grow the buffer to fit the rest, or to
+    //twice its size when the driver can not tell how much is left
+    SQLLEN more = (ind == SQL_NO_TOTAL) ? size : ind - (size - total);
+    char *grown = (char *) realloc(buffer, size + more);
+
+    if (!grown) {
+      DEBUG_PRINTF("ODBC::GetBinaryData - could not allocate %i bytes\n",
+                   size + more);
+      free(buffer);
+      *outOfMemory = true;
+      return SQL_ERROR;
+    }
+
+    buffer = grown;
+    total = size;
+    size += more;
+  }
+
+  //the Buffer this becomes keeps the whole allocation alive
+  if (total < size) {
+    char *fitted = (char *) realloc(buffer, total > 0 ? total : 1);
+
+    if (fitted) {
+      buffer = fitted;
+    }
+  }
+
+  *data = buffer;
+  *len = total;
+
+  return SQL_SUCCESS;
+}
+
+/*
+ * FreeRowBuffer
+ */
+
+void ODBC::FreeRowBuffer(RowBuffer* rows) {
+  if (rows == NULL) {
+    return;
+  }
+
+  ReleaseBlobs(rows, 0);
+  free(rows->blobs);
+  free(rows->data);
+  delete [] rows->c_types;
+  delete [] rows->deferred;
+  delete rows;
+}
+
+/*
+ * GetBufferedCellValue
+ *
+ * Decodes the cell at offset and moves offset to the next one. A binary
+ * value becomes the memory of the returned Buffer and leaves the cell. A
+ * deferred LOB is null or undefined, its value is read by GetData.
+ */
+
+Handle<Value> ODBC::GetBufferedCellValue(RowBuffer* rows, short column,
+                                         size_t* offset) {
+  Nan::EscapableHandleScope scope;
+
+  SQLLEN len = *(SQLLEN *) (rows->data + *offset);
+  char *value = rows->data + *offset + sizeof(SQLLEN);
+
+  if (rows->deferred && rows->deferred[column]) {
+    *offset += sizeof(SQLLEN);
+
+    if (len == SQL_NULL_DATA) {
+      return scope.Escape(Nan::Null());
+    }
+    return scope.Escape(Nan::Undefined());
+  }
+
+  if (rows->c_types[column] == SQL_C_BINARY) {
+    char **data = (char **) value;
+
+    *offset += sizeof(SQLLEN) + ALIGN_SQLLEN(sizeof(char *));
+
+    if (len == SQL_NULL_DATA) {
+      return scope.Escape(Nan::Null());
+    }
+    if (*data == NULL) {
+      return scope.Escape(Nan::NewBuffer(0).ToLocalChecked());
+    }
+
+    Local<Object> buffer = Nan::NewBuffer(*data, len).ToLocalChecked();
+    *data = NULL;
+
+    return scope.Escape(buffer);
+  }
+
+  *offset += sizeof(SQLLEN) + (len > 0 ? ALIGN_SQLLEN(len) : 0);
+
+  return scope.Escape(GetCellValue(rows->c_types[column], len, value));
+}
+
+/*
+ * GetBufferedRecordTuple
+ */
+
+Local<Object> ODBC::GetBufferedRecordTuple ( RowBuffer* rows, RowShape* shape,
+                                             size_t* offset) {
+  Nan::EscapableHandleScope scope;
+
+  Local<Object> tuple = Nan::NewInstance(Nan::New(shape->tmpl)).ToLocalChecked();
+
+  for(int i = 0; i < rows->colCount; i++) {
+    tuple->Set( Nan::New(shape->keys[i]),
+                GetBufferedCellValue( rows, i, offset));
+  }
+
+  return scope.Escape(tuple);
+}
+
+/*
+ * GetBufferedRecordArray
+ */
+
+Local<Value> ODBC::GetBufferedRecordArray ( RowBuffer* rows, Column* columns,
+                                            size_t* offset) {
+  Nan::EscapableHandleScope scope;
+
+  Local<Array> array = Nan::New<Array>();
+
+  for(int i = 0; i < rows->colCount; i++) {
+    array->Set( Nan::New(i),
+                GetBufferedCellValue( rows, i, offset));
+  }
+
+  return scope.Escape(array);
+}
+
+/*
+ * NewColumnSet
+ *
+ * Sets up FETCH_COLUMNAR collection for the C types the rows are read as,
+ * from the bound block or the row buffer.
+ */
+
+ColumnSet* ODBC::NewColumnSet(RowBlock* block, RowBuffer* rows) {
+  ColumnSet *set = new ColumnSet;
+
+  set->colCount = block ? block->colCount : rows->colCount;
+  set->columns = new ColumnVector[set->colCount];
+  set->rowCount = 0;
+  set->capacity = 0;
+
+  Local<Array> lists = Nan::New<Array>(set->colCount);
+
+  for (int i = 0; i < set->colCount; i++) {
+    ColumnVector *vector = &set->columns[i];
+
+    vector->c_type = block ? block->columns[i].c_type : rows->c_types[i];
+    vector->values = NULL;
+    vector->nulls = NULL;
+
+    switch (vector->c_type) {
+      case SQL_C_SLONG :
+        vector->width = sizeof(SQLINTEGER);
+        break;
+
+      case SQL_C_DOUBLE :
+        vector->width = sizeof(double);
+        break;
+
+      case SQL_C_SBIGINT :
+        vector->width = sizeof(SQLBIGINT);
+        break;
+
+      default :
+        vector->width = 0;
+        break;
+    }
+
+    lists->Set(Nan::New(i), Nan::New<Array>());
+  }
+
+  set->lists.Reset(lists);
+
+  return set;
+}
+
+/*
+ * ReserveColumnSet
+ */
+
+bool ODBC::ReserveColumnSet(ColumnSet* set, size_t rows) {
+  size_t capacity = set->capacity ? set->capacity : FETCH_BLOCK_ROWS;
+
+  if (set->rowCount + rows <= set->capacity) {
+    return true;
+  }
+
+  while (capacity < set->rowCount + rows) {
+    capacity *= 2;
+  }
+
+  for (int i = 0; i < set->colCount; i++) {
+    ColumnVector *vector = &set->columns[i];
+
+    if (vector->width) {
+      char *values = (char *) realloc(vector->values, capacity * vector->width);
+
+      if (!values) {
+        return false;
+      }
+      vector->values = values;
+    }
+
+    unsigned char *nulls = (unsigned char *) realloc(vector->nulls,
+                                                     (capacity + 7) / 8);
+    if (!nulls) {
+      return false;
+    }
+
+    memset(nulls + (set->capacity + 7) / 8, 0,
+           (capacity + 7) / 8 - (set->capacity + 7) / 8);
+    vector->nulls = nulls;
+  }
+
+  set->capacity = capacity;
+
+  return true;
+}
+
+/*
+ * SetColumnVectorValue
+ *
+ * Stores the cell of the current row; NULL is stored as 0 with the null
+ * bit set.
+ */
+
+void ODBC::SetColumnVectorValue(ColumnSet* set, short column, SQLLEN len,
+                                char* value) {
+  ColumnVector *vector = &set->columns[column];
+  char *slot = vector->values + set->rowCount * vector->width;
+
+  if (len == SQL_NULL_DATA) {
+    memset(slot, 0, vector->width);
+  }
+  else {
+    memcpy(slot, value, vector->width);
+  }
+}
+
+/*
+ * AppendBlockColumns
+ */
+
+bool ODBC::AppendBlockColumns(ColumnSet* set, RowBlock* block) {
+  if (!ReserveColumnSet(set, block->rowCount)) {
+    return false;
+  }
+
+  Local<Array> lists = Nan::New(set->lists);
+
+  for (SQLULEN row = 0; row < block->rowCount; row++) {
+    Nan::HandleScope scope;
+    char *rowData = block->buffer + (row * block->rowSize);
+
+    for (int i = 0; i < set->colCount; i++) {
+      BoundColumn *bound = &block->columns[i];
+      SQLLEN len = *(SQLLEN *) (rowData + bound->offset);
+
+      if (len == SQL_NULL_DATA) {
+        set->columns[i].nulls[set->rowCount >> 3] |= 1 << (set->rowCount & 7);
+      }
+
+      if (set->columns[i].width) {
+        SetColumnVectorValue(set, i, len, rowData + bound->offset + sizeof(SQLLEN));
+      }
+      else {
+        Local<Array>::Cast(lists->Get(i))->Set(Nan::New((uint32_t) set->rowCount),
+                                               GetBoundColumnValue(bound, rowData));
+      }
+    }
+
+    set->rowCount++;
+  }
+
+  return true;
+}
+
+/*
+ * AppendBufferedColumns
+ */
+
+bool ODBC::AppendBufferedColumns(ColumnSet* set, RowBuffer* rows) {
+  size_t offset = 0;
+
+  if (!ReserveColumnSet(set, rows->rowCount)) {
+    return false;
+  }
+
+  Local<Array> lists = Nan::New(set->lists);
+
+  for (SQLULEN row = 0; row < rows->rowCount; row++) {
+    Nan::HandleScope scope;
+
+    for (int i = 0; i < set->colCount; i++) {
+      SQLLEN len = *(SQLLEN *) (rows->data + offset);
+
+      if (len == SQL_NULL_DATA) {
+        set->columns[i].nulls[set->rowCount >> 3] |= 1 << (set->rowCount & 7);
+      }
+
+      if (set->columns[i].width) {
+        SetColumnVectorValue(set, i, len, rows->data + offset + sizeof(SQLLEN));
+        offset += sizeof(SQLLEN) + (len > 0 ? ALIGN_SQLLEN(len) : 0);
+      }
+      else {
+        Local<Array>::Cast(lists->Get(i))->Set(Nan::New((uint32_t) set->rowCount),
+                                               GetBufferedCellValue(rows, i, &offset));
+      }
+    }
+
+    set->rowCount++;
+  }
+
+  return true;
+}
+
+/*
+ * GetColumnVectorArray
+ *
+ * Int32Array, Float64Array or BigInt64Array over a copy of the values.
+ * Node 0.10 has no TypedArray API, so there the values go in an Array.
+ */
+
+Local<Value> ODBC::GetColumnVectorArray(ColumnVector* vector, size_t rowCount) {
+  Nan::EscapableHandleScope scope;
+
+#if (NODE_MODULE_VERSION < NODE_0_12_MODULE_VERSION)
+  Local<Array> values = Nan::New<Array>(rowCount);
+
+  for (size_t i = 0; i < rowCount; i++) {
+    if (vector->c_type == SQL_C_SLONG) {
+      values->Set(Nan::New((uint32_t) i),
+                  Nan::New<Number>(((SQLINTEGER *) vector->values)[i]));
+    }
+    else {
+      values->Set(Nan::New((uint32_t) i),
+                  Nan::New<Number>(((double *) vector->values)[i]));
+    }
+  }
+
+  return scope.Escape(values);
+#else
+  Local<ArrayBuffer> buffer = ArrayBuffer::New(Isolate::GetCurrent(),
+                                               rowCount * vector->width);
+
+  if (rowCount > 0) {
+    memcpy(buffer->GetContents().Data(), vector->values, rowCount * vector->width);
+  }
+
+  switch (vector->c_type) {
+    case SQL_C_SLONG :
+      return scope.Escape(Int32Array::New(buffer, 0, rowCount));
+
+#ifdef HAVE_BIGINT
+    case SQL_C_SBIGINT :
+      return scope.Escape(BigInt64Array::New(buffer, 0, rowCount));
+#endif
+
+    default :
+      return scope.Escape(Float64Array::New(buffer, 0, rowCount));
+  }
+#endif
+}
+
+/*
+ * GetColumnSetArray
+ *
+ * One { name, values, nulls } object per column. nulls is a Buffer with
+ * bit (row & 7) of byte (row >> 3) set when the value of row is NULL.
+ */
+
+Local<Array> ODBC::GetColumnSetArray(ColumnSet* set, Column* columns) {
+  Nan::EscapableHandleScope scope;
+
+  Local<Array> result = Nan::New<Array>(set->colCount);
+  Local<Array> lists = Nan::New(set->lists);
+
+  for (int i = 0; i < set->colCount; i++) {
+    ColumnVector *vector = &set->columns[i];
+    Local<Object> column = Nan::New<Object>();
+
+#ifdef UNICODE
+    column->Set(Nan::New("name").ToLocalChecked(),
+                Nan::New((uint16_t *) columns[i].name).ToLocalChecked());
+#else
+    column->Set(Nan::New("name").ToLocalChecked(),
+                Nan::New((const char *) columns[i].name).ToLocalChecked());
+#endif
+
+    if (vector->width) {
+      column->Set(Nan::New("values").ToLocalChecked(),
+                  GetColumnVectorArray(vector, set->rowCount));
+    }
+    else {
+      column->Set(Nan::New("values").ToLocalChecked(), lists->Get(i));
+    }
+
+    column->Set(Nan::New("nulls").ToLocalChecked(),
+                Nan::CopyBuffer((char *) vector->nulls,
+                                (set->rowCount + 7) / 8).ToLocalChecked());
+
+    result->Set(Nan::New(i), column);
+  }
+
+  return scope.Escape(result);
+}
+
+/*
+ * FreeColumnSet
+ */
+
+void ODBC::FreeColumnSet(ColumnSet* set) {
+  if (set == NULL) {
+    return;
+  }
+
+  for (int i = 0; i < set->colCount; i++) {
+    free(set->columns[i].values);
+    free(set->columns[i].nulls);
+  }
+
+  set->lists.Reset();
+  delete [] set->columns;
+  delete set;
+}
+
+/*
+ * AllocParameters
+ *
+ * A block with room for size bytes of parameters and their values after its
+ * header. Takes the spare block of a connection when it is big enough.
+ * Returns NULL when there is no memory for it.
+ */
+
+Parameter* ODBC::AllocParameters(size_t size, Parameter** spare) {
+  char* block = NULL;
+  
+  if (spare && *spare) {
+    block = (char *) *spare - PARAMETER_ARENA_HEADER;
+    *spare = NULL;
+    
+    if (*(size_t *) block < size) {
+      free(block);
+      block = NULL;
+    }
+  }
+  
+  if (block == NULL) {
+    block = (char *) malloc(PARAMETER_ARENA_HEADER + size);
+    
+    if (block == NULL) {
+      return NULL;
+    }
+    
+    *(size_t *) block = size;
+  }
+  
+  return (Parameter *) (block + PARAMETER_ARENA_HEADER);
+}
+
+/*
+ * FreeParameters
+ *
+ * Frees the block of a bind, or keeps it as the spare of a connection when
+ * it is the biggest one yet that is not too big to hold on to.
+ */
+
+void ODBC::FreeParameters(Parameter* params, Parameter** spare) {
+  if (params == NULL) {
+    return;
+  }
+  
+  char* block = (char *) params - PARAMETER_ARENA_HEADER;
+  size_t size = *(size_t *) block;
+  
+  if (spare && size <= MAX_PARAMETER_ARENA_SIZE) {
+    if (*spare == NULL) {
+      *spare = params;
+      return;
+    }
+    
+    char* spareBlock = (char *) *spare - PARAMETER_ARENA_HEADER;
+    
+    if (*(size_t *) spareBlock < size) {
+      *spare = params;
+      block = spareBlock;
+    }
+  }
+  
+  free(block);
+}
+
+/*
+ * GetParametersFromArray
+ *
+ * Describes the parameters in one pass, then allocates one block for the
+ * Parameter array and all of the values and writes the values into it in a
+ * second pass, so a bind costs one malloc (none with a spare block that is
+ * big enough) and FREE_PARAMS one free. Each value is read from JS once, by
+ * the first pass; the second writes what it kept. Throws and returns NULL
+ * when a parameter is malformed or there is no memory for them.
+ */
+
+Parameter* ODBC::GetParametersFromArray (Local<Array> values, int *paramCount,
+                                         Parameter** spare,
+                                         ParameterDescriptorCache* cache) {
+  DEBUG_PRINTF("ODBC::GetParametersFromArray\n");
+  int count = values->Length();
+  size_t head = PARAMETER_ALIGN(count * sizeof(Parameter));
+  size_t size = head;
+  
+  //the value each parameter is written from and the bytes it was given
+  struct ParameterValue {
+    Local<Value> data;
+    SQLLEN bytes;
+  };
+  
+  *paramCount = 0;
+  
+  Parameter* params = AllocParameters(head, spare);
+  if( !params ) {
+      Nan::LowMemoryNotification();
+      Nan::ThrowError("Could not allocate enough memory for params in ODBC::GetParametersFromArray.");
+      return params;
+  }
+
+  ParameterValue* kept = new ParameterValue[count > 0 ? count : 1];
+
+  for (int i = 0; i < count; i++) {
+    Local<Value> value = values->Get(i);
+    
+    //a getter that throws leaves an empty handle and the exception pending
+    kept[i].bytes = value.IsEmpty() ? -1 : GetParameter(value, &params[i], i+1,
+                                                        cache, &kept[i].data);
+    
+    if (kept[i].bytes < 0) {
+      delete [] kept;
+      FreeParameters(params, spare);
+      return NULL;
+    }
+    size += PARAMETER_ALIGN(kept[i].bytes);
+  }
+  
+  //grow the block to fit the values; only the Parameter array is in it yet
+  char* block = (char *) params - PARAMETER_ARENA_HEADER;
+  
+  if (*(size_t *) block < size) {
+    block = (char *) realloc(block, PARAMETER_ARENA_HEADER + size);
+    
+    if (!block) {
+      delete [] kept;
+      free((char *) params - PARAMETER_ARENA_HEADER);
+      Nan::LowMemoryNotification();
+      Nan::ThrowError("Could not allocate enough memory for params in ODBC::GetParametersFromArray.");
+      return NULL;
+    }
+    
+    *(size_t *) block = size;
+    params = (Parameter *) (block + PARAMETER_ARENA_HEADER);
+  }
+  
+  char* next = (char *) params + head;
+  
+  for (int i = 0; i < count; i++) {
+    if (WriteParameter(kept[i].data, &params[i], i+1, next,
+                       kept[i].bytes) < 0) {
+      delete [] kept;
+      FreeParameters(params, spare);
+      Nan::ThrowError("ODBC::GetParametersFromArray: a parameter value does "
+                      "not fit the room its description made for it.");
+      return NULL;
+    }
+    next += PARAMETER_ALIGN(kept[i].bytes);
+  }
+  
+  delete [] kept;
+  *paramCount = count;
+  return params;
+}
+
+/*
+ * GetParameter
+ *
+ * Describes one parameter, from a plain value, a [ParamType, CType, SQLType,
+ * Data, BufferLength] array or a { ParamType, CType, SQLType or DataType,
+ * Length, Data } object, and returns how many bytes its value takes. data
+ * is set to the value WriteParameter writes later, a string already
+ * converted, so that nothing is read from JS twice. An object whose Data is
+ * a stream takes no bytes; see GetStreamParam. Throws and returns -1 for a
+ * malformed array or object, or a value whose toString throws.
+ */
+
+SQLLEN ODBC::GetParameter(Local<Value> value, Parameter * param, int num,
+                          ParameterDescriptorCache* cache, Local<Value>* data)
+{
+    Local<Value> val;
+
+    memset(param, '\0', sizeof(Parameter));
+    
+    param->paramtype     = SQL_PARAM_INPUT;
+    param->size          = 0;
+    param->length        = SQL_NULL_DATA;
+    param->buffer_length = 0;
+    param->decimals      = 0;
+
+    DEBUG_PRINTF("ODBC::GetParameter - &param[%i].length = %p\n",
+                 num - 1, &param->length);
+
+    if (value->IsArray()) 
+    {
+      Local<Array> paramArray = Local<Array>::Cast(value);
+      int arrlen = paramArray->Length();
+      if(arrlen < 4)
+      {
+          DEBUG_PRINTF("ODBC::GetParameter - arrlen = %i\n", arrlen);
+          Nan::ThrowError("Wrong param format!");
+          return -1;
+      }
+
+      val =  paramArray->Get(0); 
+      if(val->IsInt32())
+          param->paramtype = val->IntegerValue();
+
+      val =  paramArray->Get(1); 
+      if(val->IsInt32())
+          param->c_type = val->IntegerValue();
+      else
+          param->c_type = SQL_C_CHAR;
 
       val =  paramArray->Get(2); 
       if(val->IsInt32())
-          params[i].type = val->IntegerValue();
+          param->type = val->IntegerValue();
       else
-          params[i].type = SQL_CHAR;
+          param->type = SQL_CHAR;
 
       if(arrlen == 5)
       {
           val =  paramArray->Get(4); 
           if(val->IsInt32())
-              params[i].buffer_length = val->IntegerValue();
+              param->buffer_length = val->IntegerValue();
       }
 
       val =  paramArray->Get(3); 
-      if (val->IsNull()) {
-          GetNullParam(&params[i], i+1);
+    }
+    else if (value->IsObject() && !value->IsDate() && !value->IsFunction() &&
+             !node::Buffer::HasInstance(value))
+    {
+      //the types are the same as last time at this position more often
+      //than not, so only the Data and Length are read afresh
+      Local<Object> paramObject = value->ToObject();
+      ParameterDescriptor descriptor;
+
+      GetParameterDescriptor(paramObject, num - 1, cache, &descriptor);
+
+      param->paramtype = descriptor.paramtype;
+      param->c_type    = descriptor.c_type;
+      param->type      = descriptor.type;
+
+      val = paramObject->Get(Nan::New(PROPERTY_DATA));
+      if(val.IsEmpty())
+          return -1;
+      if(val->IsUndefined())
+      {
+          Nan::ThrowTypeError("Data is missing from a parameter object");
+          return -1;
       }
-      else if (val->IsInt32()) {
-          GetInt32Param(val, &params[i], i+1);
+
+      Local<Value> length = paramObject->Get(Nan::New(PROPERTY_LENGTH));
+      if(length->IsInt32() && length->Int32Value() > 0)
+          param->buffer_length = length->Int32Value();
+
+      //a stream is read by execute, any other object is bound as a string
+      if(IsParamStream(val))
+      {
+          if(param->paramtype != SQL_PARAM_INPUT)
+          {
+              Nan::ThrowTypeError("A stream can only be an INPUT parameter");
+              return -1;
+          }
+          return GetStreamParam(param, num);
       }
-      else if (val->IsNumber()) {
-          GetNumberParam(val, &params[i], i+1);
+
+      if(val->IsNumber() && val->NumberValue() == floor(val->NumberValue()) &&
+         !isinf(val->NumberValue()))
+      {
+          if(!param->c_type) param->c_type = SQL_C_SBIGINT;
+          if(!param->type) param->type = SQL_BIGINT;
       }
-      else if (val->IsBoolean()) {
-          GetBoolParam(val, &params[i], i+1);
+      else if(param->paramtype == SQL_PARAM_OUTPUT && val->IsString() &&
+              val->ToString()->Length() == 0)
+      {
+          //an empty string makes no room for the output value
+          val = Nan::New("abc").ToLocalChecked();
       }
-      else
+
+      if(!param->c_type) param->c_type = SQL_C_CHAR;
+      if(!param->type) param->type = SQL_CHAR;
+
+      if(param->paramtype == FILE_PARAM) // For BindFileToParam()
       {
-          GetStringParam(val, &params[i], i+1);
+          param->c_type = SQL_C_CHAR;
+          if(!(param->type == SQL_BLOB || param->type == SQL_CLOB ||
+               param->type == SQL_DBCLOB || param->type == SQL_XML))
+          {
+              Nan::ThrowTypeError("DataType of a FILE parameter must be "
+                                  "BLOB, CLOB, DBCLOB or XML");
+              return -1;
+          }
+      }
+    }
+    else
+    {
+      val = value;
+
+      //only arrays and objects say what a string is, anything else is
+      //left unbound
+      if (!val->IsString() && !val->IsNull() && !val->IsNumber() &&
+          !val->IsBoolean()) {
+          return 0;
       }
     }
-    else if (value->IsString()) {
-        GetStringParam(value, &params[i], i+1);
+
+    if (val->IsNull()) {
+        return GetNullParam(param, num);
     }
-    else if (value->IsNull()) {
-        GetNullParam(&params[i], i+1);
+    else if (val->IsInt32()) {
+        *data = val;
+        return GetInt32Param(param, num);
     }
-    else if (value->IsInt32()) {
-        GetInt32Param(value, &params[i], i+1);
+    else if (val->IsNumber()) {
+        *data = val;
+        return GetNumberParam(param, num);
     }
-    else if (value->IsNumber()) {
-        GetNumberParam(value, &params[i], i+1);
+    else if (val->IsBoolean()) {
+        *data = val;
+        return GetBoolParam(param, num);
     }
-    else if (value->IsBoolean()) {
-        GetBoolParam(value, &params[i], i+1);
+
+    Local<String> string = val->ToString();
+    if (string.IsEmpty()) {
+        return -1;
     }
-  } 
-  return params;
+
+    *data = string;
+    return GetStringParam(string, param, num);
+}
+
+/*
+ * WriteParameter
+ *
+ * Writes the value GetParameter kept for a parameter into buffer, which has
+ * room for the capacity bytes GetParameter asked for, and points the
+ * parameter at it. Parameters without a value (NULL, streams, values left
+ * unbound) take nothing. Returns the bytes written, or -1 if the value does
+ * not fit.
+ */
+
+SQLLEN ODBC::WriteParameter(Local<Value> data, Parameter * param, int num,
+                            char * buffer, size_t capacity)
+{
+    if (data.IsEmpty() || capacity == 0) {
+        return 0;
+    }
+
+    param->buffer = buffer;
+
+    if (data->IsString()) {
+        return WriteStringParam(Local<String>::Cast(data), param, num,
+                                capacity);
+    }
+    else if (data->IsBoolean()) {
+        if (capacity < sizeof(bool)) {
+            return -1;
+        }
+        *(bool *) buffer = data->BooleanValue();
+        return sizeof(bool);
+    }
+
+    if (capacity < sizeof(int64_t)) {
+        return -1;
+    }
+
+    //an integral Data object may have asked for SQL_C_SBIGINT too
+    if (data->IsInt32() || param->c_type == SQL_C_SBIGINT) {
+        *(int64_t *) buffer = data->IntegerValue();
+    }
+    else {
+        *(double *) buffer = data->NumberValue();
+    }
+
+    DEBUG_PRINTF("ODBC::WriteParameter: param%u : paramtype=%u, c_type=%i, "
+                 "type=%i, size=%i, decimals=%i, buffer_length=%i, length=%i\n",
+                 num, param->paramtype, param->c_type, param->type, param->size,
+                 param->decimals, param->buffer_length, param->length);
+    return sizeof(int64_t);
+}
+
+/*
+ * GetParameterDescriptor
+ *
+ * The direction and types a parameter object names, the way parseParams in
+ * odbc.js used to work them out: ParamType "INPUT", "OUTPUT", "INOUT" or
+ * "FILE", CType "CHAR", "BINARY" or "INTEGER" and SQLType or DataType
+ * "CHAR", "BINARY", "BLOB", "CLOB", "DBCLOB", "XML", "GRAPHIC", "VARGRAPHIC"
+ * or "LONGGRAPHIC", any of them also as a number. Comes from the cache when
+ * the object at index names the same ones as the one compiled there last.
+ */
+
+void ODBC::GetParameterDescriptor(Local<Object> object, int index,
+                                  ParameterDescriptorCache* cache,
+                                  ParameterDescriptor* descriptor) {
+  Local<Value> keys[PARAMETER_DESCRIPTOR_KEYS] = {
+    object->Get(Nan::New(PROPERTY_PARAM_TYPE)),
+    object->Get(Nan::New(PROPERTY_CTYPE)),
+    object->Get(Nan::New(PROPERTY_SQL_TYPE)),
+    object->Get(Nan::New(PROPERTY_DATA_TYPE))
+  };
+  Local<Array> cached;
+  
+  if (cache) {
+    if (cache->keys.IsEmpty()) {
+      cache->keys.Reset(Nan::New<Array>());
+    }
+    
+    cached = Nan::New(cache->keys);
+    
+    if (index < cache->capacity && cache->descriptors[index].paramtype) {
+      int k = 0;
+      
+      while (k < PARAMETER_DESCRIPTOR_KEYS &&
+             keys[k]->StrictEquals(
+               cached->Get(index * PARAMETER_DESCRIPTOR_KEYS + k))) {
+        k++;
+      }
+      
+      if (k == PARAMETER_DESCRIPTOR_KEYS) {
+        *descriptor = cache->descriptors[index];
+        return;
+      }
+    }
+  }
+  
+  descriptor->paramtype = SQL_PARAM_INPUT;
+  descriptor->c_type = 0;
+  descriptor->type = 0;
+  
+  Local<Value> paramType = keys[0];
+  
+  if (paramType->BooleanValue()) {
+    if (paramType->IsInt32()) {
+      if (paramType->Int32Value() > 0 && paramType->Int32Value() < 5) {
+        descriptor->paramtype = paramType->Int32Value();
+      }
+    }
+    else {
+      Nan::Utf8String name(paramType);
+      
+      if (!strcmp(*name, "OUTPUT")) {
+        descriptor->paramtype = SQL_PARAM_OUTPUT;
+      }
+      else if (!strcmp(*name, "INOUT")) {
+        descriptor->paramtype = SQL_PARAM_INPUT_OUTPUT;
+      }
+      else if (!strcmp(*name, "FILE")) {
+        descriptor->paramtype = FILE_PARAM;
+      }
+    }
+  }
+  
+  Local<Value> cType = keys[1];
+  
+  if (cType->BooleanValue()) {
+    if (cType->IsInt32()) {
+      descriptor->c_type = cType->Int32Value();
+    }
+    else {
+      Nan::Utf8String name(cType);
+      
+      if (!strcmp(*name, "CHAR")) {
+        descriptor->c_type = SQL_C_CHAR;
+      }
+      else if (!strcmp(*name, "BINARY")) {
+        descriptor->c_type = SQL_C_BINARY;
+      }
+      else if (!strcmp(*name, "INTEGER")) {
+        descriptor->c_type = SQL_C_LONG;
+      }
+    }
+  }
+  
+  //SQLType wins over DataType
+  Local<Value> type = keys[2]->BooleanValue() ? keys[2] : keys[3];
+  
+  if (type->BooleanValue()) {
+    if (type->IsInt32()) {
+      descriptor->type = type->Int32Value();
+    }
+    else {
+      //each name with the C type it gets unless CType says otherwise; the
+      //GRAPHIC ones keep the -99 parseParams gave them
+      static const struct {
+        const char *name;
+        SQLSMALLINT type;
+        SQLSMALLINT c_type;
+      } names[] = {
+        { "CHAR",        SQL_CHAR,           SQL_C_CHAR },
+        { "BINARY",      SQL_BINARY,         SQL_C_BINARY },
+        { "BLOB",        SQL_BLOB,           SQL_C_BINARY },
+        { "CLOB",        SQL_CLOB,           SQL_C_CHAR },
+        { "DBCLOB",      SQL_DBCLOB,         SQL_DBCLOB },
+        { "XML",         SQL_XML,            SQL_C_CHAR },
+        { "GRAPHIC",     SQL_GRAPHIC,        -99 },
+        { "VARGRAPHIC",  SQL_VARGRAPHIC,     -99 },
+        { "LONGGRAPHIC", SQL_LONGVARGRAPHIC, -99 }
+      };
+      Nan::Utf8String name(type);
+      
+      for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        if (!strcmp(*name, names[i].name)) {
+          descriptor->type = names[i].type;
+          
+          if (!descriptor->c_type) {
+            descriptor->c_type = names[i].c_type;
+          }
+          break;
+        }
+      }
+    }
+  }
+  
+  if (!cache) {
+    return;
+  }
+  
+  if (index >= cache->capacity) {
+    int capacity = index + 1 > cache->capacity * 2 ? index + 1
+                                                   : cache->capacity * 2;
+    ParameterDescriptor* descriptors = (ParameterDescriptor *)
+      realloc(cache->descriptors, capacity * sizeof(ParameterDescriptor));
+    
+    //without room the next object here is compiled again, that is all
+    if (!descriptors) {
+      return;
+    }
+    
+    memset(descriptors + cache->capacity, 0,
+           (capacity - cache->capacity) * sizeof(ParameterDescriptor));
+    cache->descriptors = descriptors;
+    cache->capacity = capacity;
+  }
+  
+  cache->descriptors[index] = *descriptor;
+  
+  for (int k = 0; k < PARAMETER_DESCRIPTOR_KEYS; k++) {
+    cached->Set(index * PARAMETER_DESCRIPTOR_KEYS + k, keys[k]);
+  }
+}
+
+/*
+ * FreeParameterDescriptors
+ */
+
+void ODBC::FreeParameterDescriptors(ParameterDescriptorCache* cache) {
+  free(cache->descriptors);
+  cache->descriptors = NULL;
+  cache->capacity = 0;
+  cache->keys.Reset();
 }
 
-void ODBC::GetStringParam(Local<Value> value, Parameter * param, int num)
+size_t ODBC::GetStringParam(Local<String> string, Parameter * param, int num)
 {
-    Local<String> string = value->ToString();
     int length = string->Length();
     int bufflen = 0;
+    size_t bytes;
       
     param->length        = SQL_NTS;
     if(!param->c_type || (param->c_type == SQL_CHAR))
@@ -922,35 +3706,17 @@ void ODBC::GetStringParam(Local<Value> value, Parameter * param, int num)
     if(bufflen < param->buffer_length && (param->paramtype % 2 == 0))
         bufflen = param->buffer_length;
     param->buffer_length = bufflen;
+    bytes = bufflen;
 
     if(param->c_type == SQL_C_BINARY || param->paramtype == FILE_PARAM)
     {
         param->buffer_length = length;
         param->length        = length; 
+        //the writes below end the value with a NUL
+        bytes = (param->paramtype == FILE_PARAM ? string->Utf8Length()
+                                                : length) + 1;
     }
     param->size          = param->buffer_length;
-    param->buffer        = malloc(param->buffer_length);
-    MEMCHECK( param->buffer );
-
-    if(param->paramtype == FILE_PARAM)
-        string->WriteUtf8((char *) param->buffer);
-    else if(param->c_type == SQL_C_BINARY)
-    {
-#if (NODE_MODULE_VERSION < NODE_0_12_MODULE_VERSION)
-        memcpy(param->buffer, &string, param->buffer_length);
-        //param->buffer = &string;
-#else
-        string->WriteOneByte((uint8_t *)param->buffer);
-#endif
-    }
-    else
-    {
-        #ifdef UNICODE
-        string->Write((uint16_t *) param->buffer);
-        #else
-        string->WriteUtf8((char *) param->buffer);
-        #endif
-    }
 
     if(param->paramtype == FILE_PARAM)  // For SQLBindFileToParam()
     {
@@ -970,14 +3736,54 @@ void ODBC::GetStringParam(Local<Value> value, Parameter * param, int num)
         param->fileIndicator = 0;
     }
 
-    DEBUG_PRINTF("ODBC::GetStringParam: param%u : paramtype=%u, c_type=%i, "
+    return bytes;
+}
+
+/*
+ * WriteStringParam
+ *
+ * Writes a string GetStringParam described into param->buffer, never more
+ * than capacity bytes.
+ */
+
+SQLLEN ODBC::WriteStringParam(Local<String> string, Parameter * param,
+                              int num, size_t capacity)
+{
+    int written;
+
+    if(param->paramtype == FILE_PARAM)
+        written = string->WriteUtf8((char *) param->buffer, (int) capacity);
+    else if(param->c_type == SQL_C_BINARY)
+    {
+#if (NODE_MODULE_VERSION < NODE_0_12_MODULE_VERSION)
+        memcpy(param->buffer, &string, param->buffer_length);
+        written = param->buffer_length;
+        //param->buffer = &string;
+#else
+        written = string->WriteOneByte((uint8_t *)param->buffer, 0,
+                                       (int) capacity);
+#endif
+    }
+    else
+    {
+        #ifdef UNICODE
+        written = string->Write((uint16_t *) param->buffer, 0,
+                                (int) (capacity / sizeof(uint16_t)))
+                  * sizeof(uint16_t);
+        #else
+        written = string->WriteUtf8((char *) param->buffer, (int) capacity);
+        #endif
+    }
+
+    DEBUG_PRINTF("ODBC::WriteStringParam: param%u : paramtype=%u, c_type=%i, "
                  "type=%i, size=%i, decimals=%i, buffer=%s, buffer_length=%i, "
                  "length=%i\n", num, param->paramtype, param->c_type, 
                  param->type, param->size, param->decimals, 
                  (char *)param->buffer, param->buffer_length, param->length);
+    return written;
 }
 
-void ODBC::GetNullParam(Parameter * param, int num)
+size_t ODBC::GetNullParam(Parameter * param, int num)
 {
     param->c_type = SQL_C_DEFAULT;
     param->type   = SQL_VARCHAR;
@@ -987,58 +3793,87 @@ void ODBC::GetNullParam(Parameter * param, int num)
                  "type=%i, size=%i, decimals=%i, buffer_length=%i, length=%i\n",
                  num, param->paramtype, param->c_type, param->type, param->size,
                  param->decimals, param->buffer_length, param->length);
+    return 0;
+}
+
+/*
+ * GetStreamParam
+ *
+ * Binds a parameter with SQL_DATA_AT_EXEC, so that SQLExecute stops for its
+ * value and it is sent in chunks with SQLPutData instead of being held in
+ * memory all at once. Without a DataType it is a BLOB; its size is the
+ * Length of the parameter object or else the largest a LOB can be. The
+ * buffer is not one, just the token SQLParamData gives back for it.
+ */
+
+size_t ODBC::GetStreamParam(Parameter * param, int num)
+{
+    if(!param->type)
+        param->type = SQL_BLOB;
+    if(!param->c_type)
+        param->c_type = (param->type == SQL_BLOB ||
+                         param->type == SQL_BINARY ||
+                         param->type == SQL_VARBINARY ||
+                         param->type == SQL_LONGVARBINARY) ? SQL_C_BINARY
+                                                           : SQL_C_CHAR;
+    param->size          = param->buffer_length ? param->buffer_length
+                                                : 2147483647;
+    param->buffer_length = 0;
+    param->length        = SQL_DATA_AT_EXEC;
+    param->buffer        = (SQLPOINTER) (intptr_t) num;
+
+    DEBUG_PRINTF("ODBC::GetStreamParam: param%u : paramtype=%u, c_type=%i, "
+                 "type=%i, size=%i\n",
+                 num, param->paramtype, param->c_type, param->type, param->size);
+    return 0;
 }
 
-void ODBC::GetInt32Param(Local<Value> value, Parameter * param, int num)
+size_t ODBC::GetInt32Param(Parameter * param, int num)
 {
-    int64_t  *number = new int64_t(value->IntegerValue());
     param->c_type = SQL_C_SBIGINT;
     if(!param->type || (param->type == 1)) 
         param->type = SQL_BIGINT;
-    param->buffer = number;
-    param->length = sizeof(number);
-      
+    param->length = sizeof(int64_t);
+
     DEBUG_PRINTF("ODBC::GetInt32Param: param%u : paramtype=%u, c_type=%i, "
-                 "type=%i, size=%i, decimals=%i, buffer=%lld, buffer_length=%i, "
+                 "type=%i, size=%i, decimals=%i, buffer_length=%i, "
                  "length=%i\n",
                  num, param->paramtype, param->c_type, param->type, param->size,
-                 param->decimals, *number, param->buffer_length, param->length);
+                 param->decimals, param->buffer_length, param->length);
+    return sizeof(int64_t);
 }
 
-void ODBC::GetNumberParam(Local<Value> value, Parameter * param, int num)
+size_t ODBC::GetNumberParam(Parameter * param, int num)
 {
-    double *number   = new double(value->NumberValue());
-      
     if(!param->c_type || (param->c_type == SQL_C_CHAR)) 
         param->c_type    = SQL_C_DOUBLE;
     if(!param->type || (param->type == SQL_CHAR)) 
         param->type      = SQL_DECIMAL;
-    param->buffer        = number;
     param->buffer_length = sizeof(double);
     param->length        = param->buffer_length;
     param->decimals      = 7;
     param->size          = sizeof(double);
 
     DEBUG_PRINTF("ODBC::GetNumberParam: param%u : paramtype=%u, c_type=%i, "
-                 "type=%i, size=%i, decimals=%i, buffer=%f, buffer_length=%i, "
+                 "type=%i, size=%i, decimals=%i, buffer_length=%i, "
                  "length=%i\n",
                  num, param->paramtype, param->c_type, param->type, param->size,
-                 param->decimals, *number, param->buffer_length, param->length);
+                 param->decimals, param->buffer_length, param->length);
+    return sizeof(double);
 }
 
-void ODBC::GetBoolParam(Local<Value> value, Parameter * param, int num)
+size_t ODBC::GetBoolParam(Parameter * param, int num)
 {
-    bool *boolean    = new bool(value->BooleanValue());
     param->c_type = SQL_C_BIT;
     if(!param->type || (param->type == SQL_CHAR)) 
         param->type   = SQL_BIT;
-    param->buffer = boolean;
     param->length = 0;
       
     DEBUG_PRINTF("ODBC::GetBoolParam: param%u : paramtype=%u, c_type=%i, "
                  "type=%i, size=%i, decimals=%i, buffer_length=%i, length=%i\n",
                  num, param->paramtype, param->c_type, param->type, param->size,
                  param->decimals, param->buffer_length, param->length);
+    return sizeof(bool);
 }
 
 SQLRETURN ODBC::BindParameters(SQLHSTMT hSTMT, Parameter params[], int count)
@@ -1086,6 +3921,622 @@ SQLRETURN ODBC::BindParameters(SQLHSTMT hSTMT, Parameter params[], int count)
     return ret;
 }
 
+/*
+ * ReuseParameters
+ *
+ * Writes a new set of values over parameters that are still bound, so that
+ * a prepared statement executed again and again with values of the same
+ * types needs no allocation and no SQLBindParameter. Only plain input values
+ * qualify, and strings only while they fit the buffer of the first binding.
+ * Returns false when the values do not fit, and the parameters are then to
+ * be freed and bound afresh; some of them may have been overwritten by then.
+ */
+
+bool ODBC::ReuseParameters(Local<Array> values, Parameter params[], int count)
+{
+    DEBUG_PRINTF("ODBC::ReuseParameters\n");
+
+    if (params == NULL || (int) values->Length() != count) {
+        return false;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        Local<Value> value = values->Get(i);
+        Parameter *param = &params[i];
+
+        if (param->paramtype != SQL_PARAM_INPUT) {
+            return false;
+        }
+
+        if (value->IsNull()) {
+            //any bound buffer will do when there is no value in it
+            param->length = SQL_NULL_DATA;
+        }
+        else if (param->buffer == NULL) {
+            return false;
+        }
+        else if (value->IsInt32()) {
+            if (param->c_type != SQL_C_SBIGINT || param->type != SQL_BIGINT) {
+                return false;
+            }
+            *(int64_t *) param->buffer = value->IntegerValue();
+            param->length = sizeof(int64_t);
+        }
+        else if (value->IsNumber()) {
+            if (param->c_type != SQL_C_DOUBLE || param->type != SQL_DECIMAL) {
+                return false;
+            }
+            *(double *) param->buffer = value->NumberValue();
+            param->length = sizeof(double);
+        }
+        else if (value->IsBoolean()) {
+            if (param->c_type != SQL_C_BIT || param->type != SQL_BIT) {
+                return false;
+            }
+            *(bool *) param->buffer = value->BooleanValue();
+            param->length = 0;
+        }
+        else if (value->IsString()) {
+            Local<String> string = value->ToString();
+            int length = string->Length();
+            #ifdef UNICODE
+            SQLSMALLINT type = (length >= 8000) ? SQL_WLONGVARCHAR : SQL_WVARCHAR;
+            SQLLEN bufflen = (length * sizeof(uint16_t)) + sizeof(uint16_t);
+            #else
+            SQLSMALLINT type = (length >= 8000) ? SQL_LONGVARCHAR : SQL_VARCHAR;
+            SQLLEN bufflen = string->Utf8Length() + 1;
+            #endif
+
+            if (param->c_type != SQL_C_TCHAR || param->type != type ||
+                bufflen > param->buffer_length) {
+                return false;
+            }
+            #ifdef UNICODE
+            string->Write((uint16_t *) param->buffer);
+            #else
+            string->WriteUtf8((char *) param->buffer);
+            #endif
+            param->length = SQL_NTS;
+        }
+        else {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+ * HasStreamParameters
+ *
+ * True when GetStreamParam bound any of the parameters, whose data only the
+ * pull of ODBCStatement::Execute and ExecuteNonQuery can send.
+ */
+
+bool ODBC::HasStreamParameters(Parameter params[], int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (params[i].length == SQL_DATA_AT_EXEC) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+ * IsParamStream
+ *
+ * The test isParamStream in odbc.js makes: a Readable stream, with read and
+ * on methods, or an async iterator.
+ */
+
+bool ODBC::IsParamStream(Local<Value> value)
+{
+    if (!value->IsObject() || value->IsArray() || value->IsFunction() ||
+        node::Buffer::HasInstance(value)) {
+        return false;
+    }
+
+    Local<Object> object = value->ToObject();
+    Local<Value> read = object->Get(Nan::New("read").ToLocalChecked());
+    Local<Value> on = object->Get(Nan::New("on").ToLocalChecked());
+
+    if (read.IsEmpty() || on.IsEmpty()) {
+        return false;
+    }
+
+    if (read->IsFunction() && on->IsFunction()) {
+        return true;
+    }
+
+    Local<Value> symbol = Nan::GetCurrentContext()->Global()->Get(
+      Nan::New("Symbol").ToLocalChecked());
+
+    if (symbol.IsEmpty() || !symbol->IsFunction()) {
+        return false;
+    }
+
+    Local<Value> asyncIterator = symbol->ToObject()->Get(
+      Nan::New("asyncIterator").ToLocalChecked());
+
+    if (asyncIterator.IsEmpty() || !asyncIterator->IsSymbol()) {
+        return false;
+    }
+
+    Local<Value> iterate = object->Get(asyncIterator);
+
+    return !iterate.IsEmpty() && iterate->IsFunction();
+}
+
+/*
+ * IsParameterVector
+ *
+ * True for the TypedArrays an executeBatch column can be bound from as is.
+ */
+
+bool ODBC::IsParameterVector(Local<Value> value) {
+#if (NODE_MODULE_VERSION < NODE_0_12_MODULE_VERSION)
+  return false;
+#else
+#ifdef HAVE_BIGINT
+  if (value->IsBigInt64Array()) {
+    return true;
+  }
+#endif
+  return value->IsInt32Array() || value->IsFloat64Array();
+#endif
+}
+
+/*
+ * GetParameterBatch
+ *
+ * Copies rows of parameter values, or columns of them with columnar set,
+ * into one array per parameter for ExecuteParameterBatch. A parameter is
+ * bound as BIGINT when all of its values are integers (exact in a double,
+ * so up to 2^53), as DOUBLE when they are numbers and as BIT when they are
+ * booleans; any other mix is bound as strings as wide as the longest value.
+ * Each value is read once. A column may also be an Int32Array,
+ * Float64Array or BigInt64Array, which is bound without copying, or a
+ * { values, nulls } object like those of FETCH_COLUMNAR. Throws and returns
+ * NULL when the values do not line up or do not fit in memory.
+ */
+
+ParameterBatch* ODBC::GetParameterBatch(Local<Array> values, bool columnar) {
+  DEBUG_PRINTF("ODBC::GetParameterBatch\n");
+  
+  int listCount = values->Length();
+  
+  if (listCount == 0) {
+    Nan::ThrowError("executeBatch needs at least one row of parameters");
+    return NULL;
+  }
+  
+  //the rows, or the columns as Arrays or TypedArrays, with their NULL masks
+  Local<Object>* lists = new Local<Object>[listCount];
+  Local<Value>* masks = new Local<Value>[listCount];
+  SQLULEN listLength = 0;
+  const char* error = NULL;
+  bool typeError = true;
+  
+  for (int i = 0; !error && i < listCount; i++) {
+    Local<Value> list = values->Get(i);
+    SQLULEN length = 0;
+    
+    masks[i] = Nan::Undefined();
+    
+    if (columnar && list->IsObject() && !list->IsArray() &&
+        !IsParameterVector(list)) {
+      Local<Object> column = list->ToObject();
+      
+      masks[i] = column->Get(Nan::New("nulls").ToLocalChecked());
+      list = column->Get(Nan::New("values").ToLocalChecked());
+    }
+    
+    if (list->IsArray()) {
+      length = Local<Array>::Cast(list)->Length();
+    }
+#if (NODE_MODULE_VERSION >= NODE_0_12_MODULE_VERSION)
+    else if (columnar && IsParameterVector(list)) {
+      length = Local<TypedArray>::Cast(list)->Length();
+    }
+#endif
+    else {
+      error = columnar ? "executeBatch columns must be Arrays or TypedArrays"
+                       : "executeBatch rows must be Arrays";
+      break;
+    }
+    
+    if (i == 0) {
+      listLength = length;
+    }
+    else if (length != listLength) {
+      error = columnar ? "executeBatch columns differ in length"
+                       : "executeBatch rows differ in length";
+      typeError = false;
+      break;
+    }
+    
+    if (masks[i]->IsNull() || masks[i]->IsUndefined()) {
+      masks[i] = Nan::Undefined();
+    }
+    else if (!node::Buffer::HasInstance(masks[i]) ||
+             node::Buffer::Length(masks[i]) < (length + 7) / 8) {
+      error = "executeBatch nulls must be a Buffer with a bit per row";
+      break;
+    }
+    
+    lists[i] = list->ToObject();
+  }
+  
+  if (error) {
+    delete [] lists;
+    delete [] masks;
+    
+    if (typeError) {
+      Nan::ThrowTypeError(error);
+    }
+    else {
+      Nan::ThrowError(error);
+    }
+    return NULL;
+  }
+  
+  ParameterBatch* batch = (ParameterBatch *) calloc(1, sizeof(ParameterBatch));
+  
+  if (batch) {
+    batch->paramCount = columnar ? listCount : listLength;
+    batch->rowCount = columnar ? listLength : listCount;
+    batch->columns = new ParameterColumn[batch->paramCount + 1]();
+    batch->status = (SQLUSMALLINT *)
+      malloc((batch->rowCount + 1) * sizeof(SQLUSMALLINT));
+  }
+  
+  bool outOfMemory = !batch || !batch->status;
+  bool thrown = false;
+  
+  //the values of one parameter, strings already converted
+  Local<Value>* cells = new Local<Value>[batch ? batch->rowCount + 1 : 1];
+  
+  for (int j = 0; !outOfMemory && j < batch->paramCount; j++) {
+    ParameterColumn* column = &batch->columns[j];
+    unsigned char* nulls = NULL;
+    
+    if (columnar && !masks[j]->IsUndefined()) {
+      nulls = (unsigned char *) node::Buffer::Data(masks[j]);
+    }
+    
+#if (NODE_MODULE_VERSION >= NODE_0_12_MODULE_VERSION)
+    if (columnar && IsParameterVector(lists[j])) {
+      Local<TypedArray> vector = Local<TypedArray>::Cast(lists[j]);
+      
+      if (vector->IsInt32Array()) {
+        column->c_type = SQL_C_SLONG;
+        column->type = SQL_INTEGER;
+        column->width = sizeof(SQLINTEGER);
+      }
+#ifdef HAVE_BIGINT
+      else if (vector->IsBigInt64Array()) {
+        column->c_type = SQL_C_SBIGINT;
+        column->type = SQL_BIGINT;
+        column->width = sizeof(int64_t);
+      }
+#endif
+      else {
+        column->c_type = SQL_C_DOUBLE;
+        column->type = SQL_DOUBLE;
+        column->width = sizeof(double);
+      }
+      
+      //Buffer() moves the values of a small TypedArray off the heap, after
+      //which they stay put for as long as the array is referenced
+      column->values = (char *) vector->Buffer()->GetContents().Data()
+                     + vector->ByteOffset();
+      column->array.Reset(vector);
+      
+      //without NULLs there is no need for lengths at all
+      if (nulls) {
+        column->lengths = (SQLLEN *) malloc(batch->rowCount * sizeof(SQLLEN));
+        
+        if (!column->lengths) {
+          outOfMemory = true;
+          break;
+        }
+        
+        for (SQLULEN i = 0; i < batch->rowCount; i++) {
+          column->lengths[i] = nulls[i >> 3] & (1 << (i & 7)) ? SQL_NULL_DATA
+                                                              : column->width;
+        }
+      }
+      
+      continue;
+    }
+#endif
+    
+    bool hasInt = false, hasDouble = false, hasBool = false, hasString = false;
+    SQLULEN maxLength = 0;
+    
+    for (SQLULEN i = 0; !thrown && i < batch->rowCount; i++) {
+      Local<Value> value = columnar ? lists[j]->Get(i) : lists[i]->Get(j);
+      
+      cells[i] = value;
+      
+      if (value.IsEmpty()) {
+        thrown = true;
+      }
+      else if (value->IsNull() || value->IsUndefined()) {
+        continue;
+      }
+      else if (value->IsInt32() ||
+               (value->IsNumber() &&
+                value->NumberValue() == floor(value->NumberValue()) &&
+                fabs(value->NumberValue()) <= MAX_EXACT_INTEGER)) {
+        hasInt = true;
+      }
+      else if (value->IsNumber()) {
+        hasDouble = true;
+      }
+      else if (value->IsBoolean()) {
+        hasBool = true;
+      }
+      else {
+        hasString = true;
+      }
+    }
+    
+    if (thrown) {
+      break;
+    }
+    
+    if (hasString || (hasBool && (hasInt || hasDouble))) {
+      hasString = true;
+      
+      for (SQLULEN i = 0; !thrown && i < batch->rowCount; i++) {
+        if (!cells[i]->IsNull() && !cells[i]->IsUndefined()) {
+          Local<String> string = cells[i]->ToString();
+          
+          if (string.IsEmpty()) {
+            thrown = true;
+            break;
+          }
+          
+          cells[i] = string;
+#ifdef UNICODE
+          SQLULEN length = string->Length();
+#else
+          SQLULEN length = string->Utf8Length();
+#endif
+          maxLength = length > maxLength ? length : maxLength;
+        }
+      }
+      
+      if (thrown) {
+        break;
+      }
+      
+      column->c_type = SQL_C_TCHAR;
+#ifdef UNICODE
+      column->type = maxLength >= 8000 ? SQL_WLONGVARCHAR : SQL_WVARCHAR;
+#else
+      column->type = maxLength >= 8000 ? SQL_LONGVARCHAR : SQL_VARCHAR;
+#endif
+      column->size = maxLength > 0 ? maxLength : 1;
+      column->width = (maxLength + 1) * sizeof(SQLTCHAR);
+    }
+    else if (hasDouble) {
+      column->c_type = SQL_C_DOUBLE;
+      column->type = SQL_DOUBLE;
+      column->width = sizeof(double);
+    }
+    else if (hasInt) {
+      column->c_type = SQL_C_SBIGINT;
+      column->type = SQL_BIGINT;
+      column->width = sizeof(int64_t);
+    }
+    else if (hasBool) {
+      column->c_type = SQL_C_BIT;
+      column->type = SQL_BIT;
+      column->width = sizeof(unsigned char);
+    }
+    else {
+      //only NULLs
+      column->c_type = SQL_C_TCHAR;
+      column->type = SQL_VARCHAR;
+      column->size = 1;
+      column->width = sizeof(SQLTCHAR);
+    }
+    
+    column->values = (char *) malloc(batch->rowCount * column->width);
+    column->lengths = (SQLLEN *) malloc(batch->rowCount * sizeof(SQLLEN));
+    
+    if (!column->values || !column->lengths) {
+      outOfMemory = true;
+      break;
+    }
+    
+    for (SQLULEN i = 0; i < batch->rowCount; i++) {
+      Local<Value> value = cells[i];
+      char* cell = column->values + i * column->width;
+      
+      if (value->IsNull() || value->IsUndefined() ||
+          (nulls && (nulls[i >> 3] & (1 << (i & 7))))) {
+        column->lengths[i] = SQL_NULL_DATA;
+        continue;
+      }
+      
+      column->lengths[i] = column->width;
+      
+      switch (column->c_type) {
+        case SQL_C_DOUBLE :
+          *(double *) cell = value->NumberValue();
+          break;
+        
+        case SQL_C_SBIGINT :
+          *(int64_t *) cell = value->IntegerValue();
+          break;
+        
+        case SQL_C_BIT :
+          *(unsigned char *) cell = value->BooleanValue() ? 1 : 0;
+          break;
+        
+        default :
+#ifdef UNICODE
+          Local<String>::Cast(value)->Write((uint16_t *) cell, 0,
+                                            maxLength + 1);
+#else
+          Local<String>::Cast(value)->WriteUtf8(cell, maxLength + 1);
+#endif
+          column->lengths[i] = SQL_NTS;
+          break;
+      }
+    }
+  }
+  
+  delete [] lists;
+  delete [] masks;
+  delete [] cells;
+  
+  //the exception of a getter or toString is left pending
+  if (thrown) {
+    FreeParameterBatch(batch);
+    return NULL;
+  }
+  
+  if (outOfMemory) {
+    FreeParameterBatch(batch);
+    Nan::LowMemoryNotification();
+    Nan::ThrowError("Could not allocate enough memory for executeBatch");
+    return NULL;
+  }
+  
+  return batch;
+}
+
+/*
+ * ExecuteParameterBatch
+ *
+ * Binds the batch column-wise and executes the prepared statement once for
+ * all of its rows. Call ResetParameterBatch afterwards, once any error has
+ * been read. Does not touch V8, so it may run on the thread pool.
+ */
+
+SQLRETURN ODBC::ExecuteParameterBatch(SQLHSTMT hSTMT, ParameterBatch* batch) {
+  SQLRETURN ret = SQLSetStmtAttr(hSTMT, SQL_ATTR_PARAM_BIND_TYPE,
+                                 (SQLPOINTER) SQL_PARAM_BIND_BY_COLUMN, 0);
+  
+  if (SQL_SUCCEEDED(ret)) {
+    ret = SQLSetStmtAttr(hSTMT, SQL_ATTR_PARAMSET_SIZE,
+                         (SQLPOINTER) batch->rowCount, 0);
+  }
+  
+  if (SQL_SUCCEEDED(ret)) {
+    ret = SQLSetStmtAttr(hSTMT, SQL_ATTR_PARAM_STATUS_PTR, batch->status, 0);
+  }
+  
+  if (SQL_SUCCEEDED(ret)) {
+    ret = SQLSetStmtAttr(hSTMT, SQL_ATTR_PARAMS_PROCESSED_PTR,
+                         &batch->processed, 0);
+  }
+  
+  for (int j = 0; SQL_SUCCEEDED(ret) && j < batch->paramCount; j++) {
+    ParameterColumn* column = &batch->columns[j];
+    
+    ret = SQLBindParameter(
+      hSTMT,
+      j + 1,
+      SQL_PARAM_INPUT,
+      column->c_type,
+      column->type,
+      column->size,
+      column->decimals,
+      column->values,
+      column->width,
+      column->lengths);
+  }
+  
+  if (SQL_SUCCEEDED(ret)) {
+    ret = SQLExecute(hSTMT);
+  }
+  
+  //a searched UPDATE or DELETE that matched nothing returns SQL_NO_DATA
+  if (SQL_SUCCEEDED(ret) || ret == SQL_NO_DATA) {
+    if (!SQL_SUCCEEDED(SQLRowCount(hSTMT, &batch->affected))) {
+      batch->affected = 0;
+    }
+  }
+  
+  return ret;
+}
+
+/*
+ * ResetParameterBatch
+ *
+ * Puts the statement back to executing one row of parameters at a time.
+ */
+
+void ODBC::ResetParameterBatch(SQLHSTMT hSTMT) {
+  SQLFreeStmt(hSTMT, SQL_CLOSE);
+  SQLFreeStmt(hSTMT, SQL_RESET_PARAMS);
+  SQLSetStmtAttr(hSTMT, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER) 1, 0);
+  SQLSetStmtAttr(hSTMT, SQL_ATTR_PARAM_STATUS_PTR, NULL, 0);
+  SQLSetStmtAttr(hSTMT, SQL_ATTR_PARAMS_PROCESSED_PTR, NULL, 0);
+}
+
+/*
+ * GetParameterBatchResult
+ *
+ * { rowCount, processed, status } for the callback of executeBatch, with a
+ * SQL_PARAM_* code in status for each row of parameters.
+ */
+
+Local<Object> ODBC::GetParameterBatchResult(ParameterBatch* batch) {
+  Nan::EscapableHandleScope scope;
+  
+  Local<Object> result = Nan::New<Object>();
+  SQLULEN processed = batch->processed < batch->rowCount ? batch->processed
+                                                         : batch->rowCount;
+  Local<Array> status = Nan::New<Array>(batch->rowCount);
+  
+  for (SQLULEN i = 0; i < batch->rowCount; i++) {
+    status->Set(i, Nan::New<Number>(i < processed ? batch->status[i]
+                                                  : SQL_PARAM_UNUSED));
+  }
+  
+  result->Set(Nan::New("rowCount").ToLocalChecked(), Nan::New<Number>(batch->affected));
+  result->Set(Nan::New("processed").ToLocalChecked(), Nan::New<Number>(processed));
+  result->Set(Nan::New("status").ToLocalChecked(), status);
+  
+  return scope.Escape(result);
+}
+
+/*
+ * FreeParameterBatch
+ */
+
+void ODBC::FreeParameterBatch(ParameterBatch* batch) {
+  if (batch == NULL) {
+    return;
+  }
+  
+  for (int j = 0; batch->columns && j < batch->paramCount; j++) {
+    ParameterColumn* column = &batch->columns[j];
+    
+    //the values of a TypedArray are its own
+    if (column->array.IsEmpty()) {
+      free(column->values);
+    }
+    
+    free(column->lengths);
+    column->array.Reset();
+  }
+  
+  delete [] batch->columns;
+  free(batch->status);
+  free(batch);
+}
+
 /*
  * CallbackSQLError
  */
@@ -1221,6 +4672,7 @@ Local<Array> ODBC::GetAllRecordsSync (SQLHENV hENV,
   short colCount = 0;
   
   Column* columns = GetColumns(hSTMT, &colCount);
+  RowShape* shape = NewRowShape(columns, colCount);
   
   Local<Array> rows = Nan::New<Array>();
   
@@ -1258,11 +4710,13 @@ Local<Array> ODBC::GetAllRecordsSync (SQLHENV hENV,
         columns,
         &colCount,
         buffer,
-        bufferLength)
+        bufferLength,
+        shape)
     );
 
     count++;
   }
+  FreeRowShape(shape);
   //TODO: what do we do about errors!?!
   //we throw them
   return scope.Escape(rows);
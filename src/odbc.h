@@ -36,33 +36,91 @@ using namespace node;
 #define MAX_FIELD_SIZE 1024
 #define MAX_VALUE_SIZE 1022
 
+// Bytes GetColumns reserves per column name before its arena has to grow.
+#define COLUMN_NAME_SIZE_HINT 64
+
+// Value buffers grow past MAX_VALUE_SIZE to fit the widest non-LOB column of
+// a result set as described by GetColumns, up to this many bytes, which is
+// enough for a VARCHAR(32672) read as UTF-16.
+#define MAX_COLUMN_BUFFER_SIZE 65536
+
+// Block fetch: result sets are bound row-wise with SQLBindCol and fetched
+// up to FETCH_BLOCK_ROWS rows per SQLFetchScroll. Results with LOB columns
+// or rows wider than MAX_BLOCK_ROW_SIZE bytes are read with SQLGetData into
+// a RowBuffer instead.
+// fetchAll buffers up to FETCH_SIZE rows (the fetchSize option) per thread
+// pool round trip, but never more than MAX_FETCH_BUFFER_SIZE bytes.
+#define FETCH_BLOCK_ROWS 1000
+#define FETCH_SIZE 10000
+#define MAX_BLOCK_ROW_SIZE 32768
+#define MAX_BLOCK_SIZE 8388608
+#define MAX_FETCH_BUFFER_SIZE 33554432
+
+// Idle statement handles a connection keeps for reuse by default.
+#define STATEMENT_POOL_SIZE 4
+
+// BigInt and BigInt64Array are in the V8 API from 6.7 (node 10.4) on; nan
+// builds for node 10 from 2.10 on, hence the nan version in package.json.
+#if defined(V8_MAJOR_VERSION) && \
+    (V8_MAJOR_VERSION > 6 || (V8_MAJOR_VERSION == 6 && V8_MINOR_VERSION >= 7))
+#define HAVE_BIGINT 1
+#endif
+
+// Timestamps become Dates by plain arithmetic on their fields, read as local
+// time (the default), UTC (the default with TIMEGM) or at a fixed offset set
+// with setTimestampZone(). Local time asks mktime for the UTC offset once per
+// local hour and keeps the answer in a cache of LOCAL_OFFSET_CACHE_SIZE hours.
+#define TIMESTAMP_LOCAL 0
+#define TIMESTAMP_UTC 1
+#define TIMESTAMP_OFFSET 2
+#define LOCAL_OFFSET_CACHE_SIZE 256
+
+// Round up to a multiple of sizeof(SQLLEN) to keep bound cells aligned.
+#define ALIGN_SQLLEN(n) ((((n) + sizeof(SQLLEN) - 1) / sizeof(SQLLEN)) * sizeof(SQLLEN))
+
 #define MODE_COLLECT_AND_CALLBACK 1
 #define MODE_CALLBACK_FOR_EACH 2
 #define FETCH_ARRAY 3
 #define FETCH_OBJECT 4
+#define FETCH_COLUMNAR 5
 #define SQL_DESTROY 9999
 
-// Free Bind Parameters 
+// bigintMode and decimalMode of a result. By default BIGINT, DECIMAL and
+// NUMERIC values are strings formatted by the driver as wide characters.
+#define BIGINT_STRING 0
+#define BIGINT_NATIVE 1   // BigInt through SQL_C_SBIGINT
+#define DECIMAL_STRING 0
+#define DECIMAL_DOUBLE 1  // Number through SQL_C_DOUBLE
+#define DECIMAL_EXACT 2   // one-byte string through SQL_C_CHAR
+
+// charMode of a result. CHAR_UTF8 fetches character, date and time columns
+// as SQL_C_CHAR, which the driver must send as UTF-8 (DB2CODEPAGE=1208);
+// ASCII values then become one-byte strings. A result on a connection with
+// any other client code page keeps CHAR_WIDE. UTF8_CHAR_SIZE is the most
+// bytes a UTF-16 code unit takes in UTF-8.
+#define CHAR_WIDE 0
+#define CHAR_UTF8 1
+#define UTF8_CODEPAGE 1208
+#define UTF8_CHAR_SIZE 3
+
+// Wide values this long or shorter are narrowed on the stack by GetWideValue.
+#define MAX_NARROW_STACK_SIZE 1024
+
+// Free Bind Parameters. The values of a bind live in the same block as its
+// Parameter array (see GetParametersFromArray), so that is a single free.
 #define FREE_PARAMS( params, count )                                 \
-    Parameter prm;                                                   \
-    if(params != NULL ) {                                            \
-      for (int i = 0; i < count; i++) {                              \
-        if (prm = params[i], prm.buffer != NULL) {                   \
-          switch (prm.c_type) {                                      \
-            case SQL_C_LONG:    delete (int64_t *)prm.buffer; break; \
-            case SQL_C_DOUBLE:  delete (double  *)prm.buffer; break; \
-            case SQL_C_BIT:     delete (bool    *)prm.buffer; break; \
-            case SQL_C_CHAR:                                         \
-            case SQL_C_WCHAR:                                        \
-            default:     free(prm.buffer); prm.buffer = NULL; break; \
-          }                                                          \
-        }                                                            \
-      }                                                              \
-      free(params);                                                  \
-    }                                                                \
+    ODBC::FreeParameters(params);                                    \
     params = NULL;                                                   \
     count = 0;
 
+// The block of a bind starts with its size, PARAMETER_ALIGN'ed like each of
+// the values after the Parameter array. A connection keeps the block of its
+// last parameterized query for the next one when it is no bigger than
+// MAX_PARAMETER_ARENA_SIZE.
+#define PARAMETER_ALIGN(n) (((n) + 7) & ~((size_t) 7))
+#define PARAMETER_ARENA_HEADER PARAMETER_ALIGN(sizeof(size_t))
+#define MAX_PARAMETER_ARENA_SIZE 65536
+
 // two macros ensures that any macro used will be expanded 
 // before being stringified. #x gives string value of x.
 #define LINESTRING(x) #x
@@ -78,12 +136,147 @@ using namespace node;
 
 typedef struct {
   unsigned char *name;
-  unsigned char *type_name;
   unsigned int len;
   SQLLEN type;
+  SQLLEN octetLength;  // SQL_DESC_OCTET_LENGTH
+  SQLLEN displaySize;  // SQL_DESC_DISPLAY_SIZE
+  SQLSMALLINT c_type;  // set by SetNumericTypes and SetCharTypes, 0 to fetch by type
   SQLUSMALLINT index;
 } Column;
 
+typedef struct {
+  SQLUSMALLINT index;   // column number in the result set
+  SQLSMALLINT c_type;   // C type the column is bound as
+  SQLLEN      offset;   // offset of the length/indicator within a row
+  SQLLEN      width;    // bytes reserved for the value after the indicator
+} BoundColumn;
+
+typedef struct {
+  BoundColumn *columns;
+  short        colCount;
+  SQLLEN       rowSize;      // SQL_ATTR_ROW_BIND_TYPE
+  SQLULEN      rowArraySize; // SQL_ATTR_ROW_ARRAY_SIZE
+  SQLULEN      rowsFetched;  // SQL_ATTR_ROWS_FETCHED_PTR
+  SQLULEN      bindOffset;   // SQL_ATTR_ROW_BIND_OFFSET_PTR
+  SQLULEN      rowCapacity;  // rows the buffer may grow to, a multiple of rowArraySize
+  SQLULEN      rowsAllocated; // rows the buffer holds now, from rowArraySize up
+  int          fetchSize;    // rows asked for when the block was bound
+  SQLULEN      rowCount;     // rows buffered by the last FetchRowBlock
+  char        *buffer;
+} RowBlock;
+
+// Rows read with SQLGetData on the thread pool when a result set can not be
+// block fetched. Each cell is an SQLLEN length (or SQL_NULL_DATA) followed by
+// the value bytes padded with ALIGN_SQLLEN; cells follow each other row by row.
+// Binary cells hold a pointer to the value instead, malloc'd on its own so
+// that it can become the memory of a Buffer without being copied. Cells of
+// deferred LOB columns hold only the length, the value is streamed later.
+typedef struct {
+  SQLSMALLINT *c_types;      // C type each column is read as
+  bool        *deferred;     // LOB columns left unread, NULL unless streamLobs
+                             // picked any
+  short        colCount;
+  char        *data;
+  size_t       size;         // bytes of data in use
+  size_t       capacity;     // bytes of data allocated
+  SQLULEN      rowCount;     // rows buffered by the last FetchRowBuffer
+  size_t      *blobs;        // offsets of the binary cells in data
+  size_t       blobCount;
+  size_t       blobCapacity;
+  bool         outOfMemory;  // set when a value did not fit in memory
+} RowBuffer;
+
+// Column name keys and a row template for a result set, built on the loop
+// thread the first time a row object is needed. Row objects are instances of
+// the template, so they all start out with the same hidden class.
+struct RowShape {
+  short                            colCount;
+  Nan::Persistent<String>         *keys;
+  Nan::Persistent<ObjectTemplate>  tmpl;
+  Nan::Persistent<ObjectTemplate>  lazyTmpl;  // lazyRows, made on first use
+};
+
+// The columns and row shape of a prepared statement's first result set.
+// The first ODBCResult the statement produces fills them in and the results
+// of later executions borrow them instead of describing the columns again.
+// Results can outlive their statement, so the cache is reference counted;
+// it is only retained and released on the loop thread.
+struct ShapeCache {
+  int        refs;
+  Column    *columns;   // NULL until a result describes its columns
+  short      colCount;
+  RowShape  *shape;     // NULL until a result builds its first row object
+};
+
+// Statement handles a connection is done with, reset and kept for the next
+// query, table listing or statement instead of freed. Handles out on results
+// and statements count as in use; a pool closed with its connection is
+// freed when the last of them comes back. Only touched on the loop thread.
+typedef struct {
+  SQLHSTMT  *handles;    // idle, reset handles
+  int        count;      // idle handles
+  int        capacity;   // idle handles kept at most
+  int        inUse;
+  int        highWater;  // most handles in use at once
+  double     allocated;  // handles that had to be allocated
+  double     reused;     // handles taken from the pool
+  bool       closed;
+} StatementPool;
+
+// A statement handle that a parameterized query prepared, kept by its
+// connection under the SQL text so that the next query with the same text
+// skips SQLPrepare. It is busy while a result reads from it; closing the
+// result hands it back, or frees it if the cache dropped it in the meantime.
+struct CachedStatement {
+  CachedStatement  *prev;        // more recently used
+  CachedStatement  *next;        // less recently used
+  SQLHSTMT          hSTMT;
+  void             *sql;
+  int               sqlSize;     // bytes, including the terminator
+  bool              busy;
+  bool              evicted;     // no longer in the cache
+  ShapeCache       *shapeCache;  // shared by the results of the statement
+  StatementPool    *pool;        // where the handle goes when evicted
+};
+
+// A connection's prepared statements, most recently used first. Only
+// touched on the loop thread.
+typedef struct {
+  CachedStatement  *head;
+  CachedStatement  *tail;
+  int               count;
+  int               capacity;    // 0 disables the cache
+  double            hits;        // lookups that found an idle statement
+  double            misses;      // lookups that had to prepare, cache on
+} StatementCache;
+
+// A block of rows copied out of a RowBlock for lazyRows, in memory owned by
+// a Buffer. The header is followed by the BoundColumn layout and then the
+// rows, each part starting on an SQLLEN boundary. Lazy row objects keep the
+// Buffer alive and decode a column the first time it is read.
+typedef struct {
+  short    colCount;
+  SQLLEN   rowSize;
+  SQLULEN  rowCount;
+} LazyBlock;
+
+// FETCH_COLUMNAR collects integer and floating point cells in native vectors
+// that become TypedArrays; other cells are collected as JavaScript values.
+typedef struct {
+  SQLSMALLINT    c_type;  // C type of the cells
+  size_t         width;   // bytes per native value, 0 for JavaScript values
+  char          *values;
+  unsigned char *nulls;   // one bit per row, set for NULL
+} ColumnVector;
+
+struct ColumnSet {
+  ColumnVector           *columns;
+  short                   colCount;
+  size_t                  rowCount;
+  size_t                  capacity;  // rows the vectors have room for
+  Nan::Persistent<Array>  lists;     // JavaScript values, one Array per column
+};
+
 typedef struct {
   SQLSMALLINT  paramtype;
   SQLSMALLINT  c_type;
@@ -97,19 +290,129 @@ typedef struct {
   SQLINTEGER   fileIndicator; // For BindFileToParam
 } Parameter;
 
+// The direction and types a { ParamType, CType, SQLType or DataType, Length,
+// Data } parameter object names, with 0 for a type left to its Data. A
+// ParameterDescriptorCache keeps them by parameter position along with the
+// PARAMETER_DESCRIPTOR_KEYS property values they were compiled from, so that
+// objects naming the same types as last time skip the compiling.
+#define PARAMETER_DESCRIPTOR_KEYS 4
+
+typedef struct {
+  SQLSMALLINT  paramtype;  // 0 for a position with nothing cached
+  SQLSMALLINT  c_type;
+  SQLSMALLINT  type;
+} ParameterDescriptor;
+
+struct ParameterDescriptorCache {
+  ParameterDescriptor     *descriptors;
+  int                      capacity;
+  Nan::Persistent<Array>   keys;  // ParamType, CType, SQLType and DataType
+                                  // of each position
+};
+
+// One parameter of an executeBatch, as an array of values bound with
+// SQL_PARAM_BIND_BY_COLUMN. A column given as an Int32Array, Float64Array or
+// BigInt64Array is bound where the TypedArray keeps its values, which array
+// holds on to until the batch is freed.
+struct ParameterColumn {
+  SQLSMALLINT              c_type;
+  SQLSMALLINT              type;
+  SQLULEN                  size;
+  SQLSMALLINT              decimals;
+  SQLLEN                   width;    // bytes per value
+  char                    *values;   // rowCount values, width bytes apart
+  SQLLEN                  *lengths;  // rowCount lengths or SQL_NULL_DATA, or
+                                     // NULL for a TypedArray without NULLs
+  Nan::Persistent<Object>  array;    // the TypedArray values points into
+};
+
+// The parameters of an executeBatch and what SQLExecute reported for it.
+typedef struct {
+  ParameterColumn  *columns;
+  int               paramCount;
+  SQLULEN           rowCount;   // rows of parameters, SQL_ATTR_PARAMSET_SIZE
+  SQLUSMALLINT     *status;     // SQL_PARAM_SUCCESS etc. per row
+  SQLULEN           processed;  // rows the driver got to
+  SQLLEN            affected;   // SQLRowCount over all of the rows
+} ParameterBatch;
+
+// The largest integer a Number holds exactly; executeBatch binds integral
+// Numbers up to it as BIGINT.
+#define MAX_EXACT_INTEGER 9007199254740992.0
+
+typedef struct {
+  bool   used;
+  double hour;    // local hours since the epoch
+  double offset;  // seconds local time is ahead of UTC in that hour
+} LocalOffset;
+
 class ODBC : public Nan::ObjectWrap {
   public:
     static Nan::Persistent<Function> constructor;
     static uv_mutex_t g_odbcMutex;
     static uv_async_t g_async;
+    static int g_timestampZone;
+    static double g_timestampOffset;
+    static LocalOffset g_localOffsets[LOCAL_OFFSET_CACHE_SIZE];
+    static Nan::Persistent<String> PROPERTY_MICROSECONDS;
+    static Nan::Persistent<String> PROPERTY_PARAM_TYPE;
+    static Nan::Persistent<String> PROPERTY_CTYPE;
+    static Nan::Persistent<String> PROPERTY_SQL_TYPE;
+    static Nan::Persistent<String> PROPERTY_DATA_TYPE;
+    static Nan::Persistent<String> PROPERTY_LENGTH;
+    static Nan::Persistent<String> PROPERTY_DATA;
     
     static void Init(v8::Handle<Object> exports);
     static Column* GetColumns(SQLHSTMT hStmt, short* colCount);
     static void FreeColumns(Column* columns, short* colCount);
+    static int GetColumnBufferLength(Column* columns, short colCount);
+    static void SetNumericTypes(Column* columns, short colCount, int bigintMode, int decimalMode);
+    static void SetCharTypes(Column* columns, short colCount, int charMode);
     static Handle<Value> GetColumnValue(SQLHSTMT hStmt, Column column, uint16_t* buffer, int bufferLength);
-    static Handle<Value> GetOutputParameter(Parameter prm);
-    static Local<Object> GetRecordTuple (SQLHSTMT hStmt, Column* columns, short* colCount, uint16_t* buffer, int bufferLength);
+    static Handle<Value> GetOutputParameter(Parameter &prm);
+    static Local<Object> GetRecordTuple (SQLHSTMT hStmt, Column* columns, short* colCount, uint16_t* buffer, int bufferLength, RowShape* shape);
     static Local<Value> GetRecordArray (SQLHSTMT hStmt, Column* columns, short* colCount, uint16_t* buffer, int bufferLength);
+    static Local<Value> GetTimestampValue(SQL_TIMESTAMP_STRUCT* odbcTime);
+    static double DaysFromCivil(int year, int month, int day);
+    static double GetLocalOffset(SQL_TIMESTAMP_STRUCT* odbcTime, double localSeconds);
+    static RowShape* NewRowShape(Column* columns, short colCount);
+    static void FreeRowShape(RowShape* shape);
+    static ShapeCache* NewShapeCache();
+    static void ReleaseShapeCache(ShapeCache* cache);
+    static CachedStatement* GetCachedStatement(StatementCache* cache, void* sql, int sqlSize);
+    static CachedStatement* AddCachedStatement(StatementCache* cache, StatementPool* pool, SQLHSTMT hStmt, void* sql, int sqlSize);
+    static void ReleaseCachedStatement(CachedStatement* stmt);
+    static void ResizeStatementCache(StatementCache* cache, int capacity);
+    static void FreeCachedStatement(CachedStatement* stmt);
+    static StatementPool* NewStatementPool(int capacity);
+    static SQLHSTMT TakePooledStatement(StatementPool* pool);
+    static void ReleasePooledStatement(StatementPool* pool, SQLHSTMT hStmt);
+    static void ResizeStatementPool(StatementPool* pool, int capacity);
+    static void CloseStatementPool(StatementPool* pool);
+    static RowBlock* BindRowBlock(SQLHSTMT hStmt, Column* columns, short colCount, int fetchSize);
+    static SQLRETURN FetchRowBlock(SQLHSTMT hStmt, RowBlock* block);
+    static SQLRETURN BindRowBlockColumns(SQLHSTMT hStmt, RowBlock* block);
+    static void FreeRowBlock(SQLHSTMT hStmt, RowBlock* block);
+    static Handle<Value> GetBoundColumnValue(BoundColumn* bound, char* row);
+    static Local<Object> GetBlockRecordTuple (RowBlock* block, RowShape* shape, SQLULEN row);
+    static Local<Object> NewLazyBlock(RowBlock* block);
+    static Local<Object> GetLazyRecordTuple (Local<Object> lazyBlock, RowShape* shape, SQLULEN row);
+    static Local<Value> GetBlockRecordArray (RowBlock* block, Column* columns, SQLULEN row);
+    static RowBuffer* NewRowBuffer(Column* columns, short colCount, const bool* stream);
+    static bool IsStreamableLob(Column* column);
+    static SQLRETURN FetchRowBuffer(SQLHSTMT hStmt, Column* columns, RowBuffer* rows, int maxRows);
+    static void FreeRowBuffer(RowBuffer* rows);
+    static Local<Object> GetBufferedRecordTuple (RowBuffer* rows, RowShape* shape, size_t* offset);
+    static Local<Value> GetBufferedRecordArray (RowBuffer* rows, Column* columns, size_t* offset);
+    static Handle<Value> GetCellValue(SQLSMALLINT c_type, SQLLEN len, char* value);
+    static Local<String> GetUtf8Value(const char* value, size_t len);
+    static Local<String> GetWideValue(const uint16_t* value, size_t len);
+    static Local<String> GetWideValue(const uint16_t* value);
+    static ColumnSet* NewColumnSet(RowBlock* block, RowBuffer* rows);
+    static bool AppendBlockColumns(ColumnSet* set, RowBlock* block);
+    static bool AppendBufferedColumns(ColumnSet* set, RowBuffer* rows);
+    static Local<Array> GetColumnSetArray(ColumnSet* set, Column* columns);
+    static void FreeColumnSet(ColumnSet* set);
     static Handle<Value> CallbackSQLError(SQLSMALLINT handleType, SQLHANDLE handle, Nan::Callback* cb);
     static Local<Value> CallbackSQLError (SQLSMALLINT handleType, SQLHANDLE handle, char* message, Nan::Callback* cb);
     static Local<Value> GetSQLError (SQLSMALLINT handleType, SQLHANDLE handle);
@@ -118,8 +421,25 @@ class ODBC : public Nan::ObjectWrap {
 #ifdef dynodbc
     static Handle<Value> LoadODBCLibrary(const Arguments& info);
 #endif
-    static Parameter* GetParametersFromArray (Local<Array> values, int* paramCount);
+    static Parameter* GetParametersFromArray (Local<Array> values, int* paramCount,
+                                              Parameter** spare = NULL,
+                                              ParameterDescriptorCache* cache = NULL);
+    static void       GetParameterDescriptor(Local<Object> object, int index,
+                                             ParameterDescriptorCache* cache,
+                                             ParameterDescriptor* descriptor);
+    static void       FreeParameterDescriptors(ParameterDescriptorCache* cache);
+    static Parameter* AllocParameters(size_t size, Parameter** spare);
+    static void       FreeParameters(Parameter* params, Parameter** spare = NULL);
     static SQLRETURN  BindParameters(SQLHSTMT hSTMT, Parameter params[], int count);
+    static bool       ReuseParameters(Local<Array> values, Parameter params[], int count);
+    static bool       HasStreamParameters(Parameter params[], int count);
+    static bool       IsParamStream(Local<Value> value);
+    static bool IsParameterVector(Local<Value> value);
+    static ParameterBatch* GetParameterBatch(Local<Array> values, bool columnar);
+    static SQLRETURN ExecuteParameterBatch(SQLHSTMT hSTMT, ParameterBatch* batch);
+    static void ResetParameterBatch(SQLHSTMT hSTMT);
+    static Local<Object> GetParameterBatchResult(ParameterBatch* batch);
+    static void FreeParameterBatch(ParameterBatch* batch);
     
     void Free();
     
@@ -128,13 +448,34 @@ class ODBC : public Nan::ObjectWrap {
 
     ~ODBC();
 
-    static void GetStringParam(Local<Value> value, Parameter * param, int num);
-    static void GetNullParam(Parameter * param, int num);
-    static void GetInt32Param(Local<Value> value, Parameter * param, int num);
-    static void GetNumberParam(Local<Value> value, Parameter * param, int num);
-    static void GetBoolParam(Local<Value> value, Parameter * param, int num);
+    static SQLLEN GetParameter(Local<Value> value, Parameter * param, int num,
+                               ParameterDescriptorCache* cache, Local<Value>* data);
+    static SQLLEN WriteParameter(Local<Value> data, Parameter * param, int num, char * buffer,
+                                 size_t capacity);
+    static size_t GetStringParam(Local<String> string, Parameter * param, int num);
+    static SQLLEN WriteStringParam(Local<String> string, Parameter * param, int num, size_t capacity);
+    static size_t GetNullParam(Parameter * param, int num);
+    static size_t GetStreamParam(Parameter * param, int num);
+    static size_t GetInt32Param(Parameter * param, int num);
+    static size_t GetNumberParam(Parameter * param, int num);
+    static size_t GetBoolParam(Parameter * param, int num);
+    static Local<String> NewColumnKey(Column* column);
+    static bool ReserveRowBuffer(RowBuffer* rows, size_t bytes);
+    static void ReleaseBlobs(RowBuffer* rows, size_t offset);
+    static SQLRETURN GetBinaryData(SQLHSTMT hStmt, SQLUSMALLINT index, char** data, SQLLEN* len, bool* outOfMemory);
+    static SQLLEN GetColumnWidth(Column* column);
+    static bool IsAscii(const char* value, size_t len);
+    static SQLRETURN GetCellData(SQLHSTMT hStmt, Column* column, SQLSMALLINT c_type, RowBuffer* rows);
+    static SQLRETURN GetDeferredCellData(SQLHSTMT hStmt, SQLUSMALLINT index, SQLSMALLINT c_type, RowBuffer* rows);
+    static Handle<Value> GetBufferedCellValue(RowBuffer* rows, short column, size_t* offset);
+    static bool ReserveColumnSet(ColumnSet* set, size_t rows);
+    static void SetColumnVectorValue(ColumnSet* set, short column, SQLLEN len, char* value);
+    static Local<Value> GetColumnVectorArray(ColumnVector* vector, size_t rowCount);
+    static NAN_GETTER(GetLazyValue);
+    static NAN_SETTER(SetLazyValue);
 
     static NAN_METHOD(New);
+    static NAN_METHOD(SetTimestampZone);
 
     //async methods
     static NAN_METHOD(CreateConnection);
@@ -56,6 +56,10 @@ void ODBCConnection::Init(v8::Handle<Object> exports) {
   //Nan::SetAccessor(instance_template, Nan::New("mode").ToLocalChecked(), ModeGetter, ModeSetter);
   Nan::SetAccessor(instance_template, Nan::New("connected").ToLocalChecked(), ConnectedGetter);
   Nan::SetAccessor(instance_template, Nan::New("connectTimeout").ToLocalChecked(), ConnectTimeoutGetter, ConnectTimeoutSetter);
+  Nan::SetAccessor(instance_template, Nan::New("statementCacheSize").ToLocalChecked(), StatementCacheSizeGetter, StatementCacheSizeSetter);
+  Nan::SetAccessor(instance_template, Nan::New("statementCacheStats").ToLocalChecked(), StatementCacheStatsGetter);
+  Nan::SetAccessor(instance_template, Nan::New("statementPoolSize").ToLocalChecked(), StatementPoolSizeGetter, StatementPoolSizeSetter);
+  Nan::SetAccessor(instance_template, Nan::New("statementPoolStats").ToLocalChecked(), StatementPoolStatsGetter);
   
   // Prototype Methods
   Nan::SetPrototypeMethod(constructor_template, "open", Open);
@@ -85,10 +89,15 @@ void ODBCConnection::Init(v8::Handle<Object> exports) {
 ODBCConnection::~ODBCConnection() {
   DEBUG_PRINTF("ODBCConnection::~ODBCConnection\n");
   this->Free();
+  
+  ODBC::FreeParameters(paramArena);
+  ODBC::FreeParameterDescriptors(&paramDescriptors);
 }
 
 void ODBCConnection::Free() {
   DEBUG_PRINTF("ODBCConnection::Free m_hDBC = %i \n", m_hDBC);
+  FreeStatements();
+  
   if (m_hDBC) {
     SQLDisconnect(m_hDBC);
     SQLFreeHandle(SQL_HANDLE_DBC, m_hDBC);
@@ -117,6 +126,19 @@ NAN_METHOD(ODBCConnection::New) {
   //set default connectTimeout to 30 seconds
   conn->connectTimeout = 30;
   
+  //parameterized queries are prepared every time unless statementCacheSize
+  //is set
+  memset(&conn->statementCache, 0, sizeof(StatementCache));
+  
+  //statement handles are kept for reuse once the connection is open
+  conn->statementPool = NULL;
+  conn->statementPoolSize = STATEMENT_POOL_SIZE;
+  
+  //the parameters of a query go in the block of the one before
+  conn->paramArena = NULL;
+  conn->paramDescriptors.descriptors = NULL;
+  conn->paramDescriptors.capacity = 0;
+  
   info.GetReturnValue().Set(info.Holder());
 }
 
@@ -146,6 +168,100 @@ NAN_SETTER(ODBCConnection::ConnectTimeoutSetter) {
   }
 }
 
+NAN_GETTER(ODBCConnection::StatementCacheSizeGetter) {
+  Nan::HandleScope scope;
+
+  ODBCConnection *obj = Nan::ObjectWrap::Unwrap<ODBCConnection>(info.Holder());
+
+  info.GetReturnValue().Set(Nan::New<Number>(obj->statementCache.capacity));
+}
+
+NAN_SETTER(ODBCConnection::StatementCacheSizeSetter) {
+  Nan::HandleScope scope;
+
+  ODBCConnection *obj = Nan::ObjectWrap::Unwrap<ODBCConnection>(info.Holder());
+  
+  if (value->IsNumber()) {
+    ODBC::ResizeStatementCache(&obj->statementCache, value->Int32Value());
+  }
+}
+
+NAN_GETTER(ODBCConnection::StatementCacheStatsGetter) {
+  Nan::HandleScope scope;
+
+  ODBCConnection *obj = Nan::ObjectWrap::Unwrap<ODBCConnection>(info.Holder());
+  StatementCache *cache = &obj->statementCache;
+  
+  Local<Object> stats = Nan::New<Object>();
+  
+  stats->Set(Nan::New("size").ToLocalChecked(), Nan::New<Number>(cache->capacity));
+  stats->Set(Nan::New("count").ToLocalChecked(), Nan::New<Number>(cache->count));
+  stats->Set(Nan::New("hits").ToLocalChecked(), Nan::New<Number>(cache->hits));
+  stats->Set(Nan::New("misses").ToLocalChecked(), Nan::New<Number>(cache->misses));
+
+  info.GetReturnValue().Set(stats);
+}
+
+NAN_GETTER(ODBCConnection::StatementPoolSizeGetter) {
+  Nan::HandleScope scope;
+
+  ODBCConnection *obj = Nan::ObjectWrap::Unwrap<ODBCConnection>(info.Holder());
+
+  info.GetReturnValue().Set(Nan::New<Number>(obj->statementPoolSize));
+}
+
+NAN_SETTER(ODBCConnection::StatementPoolSizeSetter) {
+  Nan::HandleScope scope;
+
+  ODBCConnection *obj = Nan::ObjectWrap::Unwrap<ODBCConnection>(info.Holder());
+  
+  if (value->IsNumber()) {
+    obj->statementPoolSize = value->Int32Value() > 0 ? value->Int32Value() : 0;
+    
+    if (obj->statementPool) {
+      ODBC::ResizeStatementPool(obj->statementPool, obj->statementPoolSize);
+    }
+  }
+}
+
+NAN_GETTER(ODBCConnection::StatementPoolStatsGetter) {
+  Nan::HandleScope scope;
+
+  ODBCConnection *obj = Nan::ObjectWrap::Unwrap<ODBCConnection>(info.Holder());
+  StatementPool *pool = obj->statementPool;
+  
+  Local<Object> stats = Nan::New<Object>();
+  
+  stats->Set(Nan::New("size").ToLocalChecked(), Nan::New<Number>(obj->statementPoolSize));
+  stats->Set(Nan::New("idle").ToLocalChecked(), Nan::New<Number>(pool ? pool->count : 0));
+  stats->Set(Nan::New("inUse").ToLocalChecked(), Nan::New<Number>(pool ? pool->inUse : 0));
+  stats->Set(Nan::New("highWater").ToLocalChecked(), Nan::New<Number>(pool ? pool->highWater : 0));
+  stats->Set(Nan::New("allocated").ToLocalChecked(), Nan::New<Number>(pool ? pool->allocated : 0));
+  stats->Set(Nan::New("reused").ToLocalChecked(), Nan::New<Number>(pool ? pool->reused : 0));
+
+  info.GetReturnValue().Set(stats);
+}
+
+/*
+ * FreeStatements
+ *
+ * Frees the cached statements and the idle pooled handles before the
+ * connection goes away, keeping the cache and pool sizes for the next open.
+ * Handles still in use are freed as their results and statements let go of
+ * them. Must run on the loop thread, so Close does it before queueing
+ * UV_Close and the Free there finds nothing left to do.
+ */
+
+void ODBCConnection::FreeStatements() {
+  int capacity = statementCache.capacity;
+  
+  ODBC::ResizeStatementCache(&statementCache, 0);
+  statementCache.capacity = capacity;
+  
+  ODBC::CloseStatementPool(statementPool);
+  statementPool = NULL;
+}
+
 /*
  * Open
  * 
@@ -277,6 +393,10 @@ void ODBCConnection::UV_AfterOpen(uv_work_t* req, int status) {
 
   if (!err) {
    data->conn->self()->connected = true;
+   
+   if (data->conn->statementPool == NULL) {
+     data->conn->statementPool = ODBC::NewStatementPool(data->conn->statementPoolSize);
+   }
     
     //only uv_ref if the connection was successful
 //#if NODE_VERSION_AT_LEAST(0, 7, 9)
@@ -384,6 +504,10 @@ NAN_METHOD(ODBCConnection::OpenSync) {
     
     conn->self()->connected = true;
     
+    if (conn->statementPool == NULL) {
+      conn->statementPool = ODBC::NewStatementPool(conn->statementPoolSize);
+    }
+    
     //only uv_ref if the connection was successful
     /*#if NODE_VERSION_AT_LEAST(0, 7, 9)
       uv_ref((uv_handle_t *)&ODBC::g_async);
@@ -427,6 +551,8 @@ NAN_METHOD(ODBCConnection::Close) {
 
   work_req->data = data;
   
+  conn->FreeStatements();
+  
   uv_queue_work(
     uv_default_loop(),
     work_req,
@@ -529,19 +655,22 @@ NAN_METHOD(ODBCConnection::CreateStatementSync) {
 
   ODBCConnection* conn = Nan::ObjectWrap::Unwrap<ODBCConnection>(info.Holder());
    
-  SQLHSTMT hSTMT;
+  SQLHSTMT hSTMT = ODBC::TakePooledStatement(conn->statementPool);
 
-  SQLAllocHandle(
-    SQL_HANDLE_STMT, 
-    conn->m_hDBC, 
-    &hSTMT);
+  if (!hSTMT) {
+    SQLAllocHandle(
+      SQL_HANDLE_STMT, 
+      conn->m_hDBC, 
+      &hSTMT);
+  }
   
-  Local<Value> params[3];
+  Local<Value> params[4];
   params[0] = Nan::New<External>((void*)(intptr_t)conn->m_hENV);
   params[1] = Nan::New<External>((void*)(intptr_t)conn->m_hDBC);
   params[2] = Nan::New<External>((void*)(intptr_t)hSTMT);
+  params[3] = Nan::New<External>((void*)conn->statementPool);
   
-  Local<Object> js_result(Nan::New<Function>(ODBCStatement::constructor)->NewInstance(3, params));
+  Local<Object> js_result(Nan::New<Function>(ODBCStatement::constructor)->NewInstance(4, params));
   
   info.GetReturnValue().Set(js_result);
 }
@@ -570,6 +699,8 @@ NAN_METHOD(ODBCConnection::CreateStatement) {
 
   data->cb = new Nan::Callback(cb);
   data->conn = conn;
+  data->pool = conn->statementPool;
+  data->hSTMT = ODBC::TakePooledStatement(data->pool);
 
   work_req->data = data;
   
@@ -596,10 +727,12 @@ void ODBCConnection::UV_CreateStatement(uv_work_t* req) {
     data->hSTMT
   );
   
-  //allocate a new statment handle
-  SQLAllocHandle( SQL_HANDLE_STMT, 
-                  data->conn->m_hDBC, 
-                  &data->hSTMT);
+  //allocate a new statment handle unless the pool had one
+  if (!data->hSTMT) {
+    SQLAllocHandle( SQL_HANDLE_STMT, 
+                    data->conn->m_hDBC, 
+                    &data->hSTMT);
+  }
 
   DEBUG_PRINTF("ODBCConnection::UV_CreateStatement m_hDBC=%X m_hDBC=%X m_hSTMT=%X\n",
     data->conn->m_hENV,
@@ -620,12 +753,13 @@ void ODBCConnection::UV_AfterCreateStatement(uv_work_t* req, int status) {
     data->hSTMT
   );
   
-  Local<Value> info[3];
+  Local<Value> info[4];
   info[0] = Nan::New<External>((void*)(intptr_t)data->conn->m_hENV);
   info[1] = Nan::New<External>((void*)(intptr_t)data->conn->m_hDBC);
   info[2] = Nan::New<External>((void*)(intptr_t)data->hSTMT);
+  info[3] = Nan::New<External>((void*)data->pool);
   
-  Local<Object> js_result = Nan::New<Function>(ODBCStatement::constructor)->NewInstance(3, info);
+  Local<Object> js_result = Nan::New<Function>(ODBCStatement::constructor)->NewInstance(4, info);
 
   info[0] = Nan::Null();
   info[1] = js_result;
@@ -665,6 +799,8 @@ NAN_METHOD(ODBCConnection::Query) {
   
   query_work_data* data = (query_work_data *) calloc(1, sizeof(query_work_data));
   MEMCHECK( data ) ;
+  
+  bool badParams = false;
 
   //Check arguments for different variations of calling this function
   if (info.Length() == 3) {
@@ -684,7 +820,10 @@ NAN_METHOD(ODBCConnection::Query) {
     
     data->params = ODBC::GetParametersFromArray(
       Local<Array>::Cast(info[1]),
-      &data->paramCount);
+      &data->paramCount,
+      &conn->paramArena,
+      &conn->paramDescriptors);
+    badParams = !data->params;
     
     cb = Local<Function>::Cast(info[2]);
   }
@@ -724,7 +863,10 @@ NAN_METHOD(ODBCConnection::Query) {
       if (obj->Has(optionParamsKey) && obj->Get(optionParamsKey)->IsArray()) {
         data->params = ODBC::GetParametersFromArray(
           Local<Array>::Cast(obj->Get(optionParamsKey)),
-          &data->paramCount);
+          &data->paramCount,
+          &conn->paramArena,
+          &conn->paramDescriptors);
+        badParams = !data->params;
       }
       else {
         data->paramCount = 0;
@@ -747,6 +889,21 @@ NAN_METHOD(ODBCConnection::Query) {
   }
   //Done checking arguments
 
+  //streams are read by the execute of a prepared statement only
+  if (!badParams && ODBC::HasStreamParameters(data->params, data->paramCount)) {
+    ODBC::FreeParameters(data->params, &conn->paramArena);
+    Nan::ThrowTypeError("ODBCConnection::Query(): stream parameters can only "
+                        "be sent by ODBCStatement::Execute or ExecuteNonQuery.");
+    badParams = true;
+  }
+
+  //a malformed parameter has thrown already
+  if (badParams) {
+    free(data);
+    free(work_req);
+    return;
+  }
+
   data->cb = new Nan::Callback(cb);
   data->sqlLen = sql->Length();
 
@@ -765,6 +922,18 @@ NAN_METHOD(ODBCConnection::Query) {
   DEBUG_PRINTF("ODBCConnection::Query : sqlLen=%i, sqlSize=%i, sql=%s\n",
                data->sqlLen, data->sqlSize, (char*) data->sql);
   
+  //reuse a statement an earlier query with the same SQL prepared
+  if (data->paramCount) {
+    data->cachedStmt = ODBC::GetCachedStatement(
+      &conn->statementCache, data->sql, data->sqlSize);
+  }
+  
+  //or at least a statement handle an earlier query is done with
+  if (!data->cachedStmt) {
+    data->pool = conn->statementPool;
+    data->hSTMT = ODBC::TakePooledStatement(data->pool);
+  }
+  
   data->conn = conn;
   work_req->data = data;
   
@@ -786,10 +955,17 @@ void ODBCConnection::UV_Query(uv_work_t* req) {
   
   SQLRETURN ret;
   
-  //allocate a new statment handle
-  SQLAllocHandle( SQL_HANDLE_STMT, 
-                  data->conn->m_hDBC, 
-                  &data->hSTMT );
+  if (data->cachedStmt) {
+    //already prepared, only the parameters change
+    data->hSTMT = data->cachedStmt->hSTMT;
+    ret = SQL_SUCCESS;
+  }
+  else if (!data->hSTMT) {
+    //allocate a new statment handle
+    SQLAllocHandle( SQL_HANDLE_STMT, 
+                    data->conn->m_hDBC, 
+                    &data->hSTMT );
+  }
 
   //check to see if should excute a direct or a parameter bound query
   if (!data->paramCount) {
@@ -801,10 +977,14 @@ void ODBCConnection::UV_Query(uv_work_t* req) {
   }
   else {
     // prepare statement, bind parameters and execute statement 
-    ret = SQLPrepare(
-      data->hSTMT,
-      (SQLTCHAR *) data->sql, 
-      data->sqlLen);
+    if (!data->cachedStmt) {
+      ret = SQLPrepare(
+        data->hSTMT,
+        (SQLTCHAR *) data->sql, 
+        data->sqlLen);
+      
+      data->prepared = SQL_SUCCEEDED(ret);
+    }
     
     if (ret == SQL_SUCCESS || ret == SQL_SUCCESS_WITH_INFO) {
 
@@ -832,6 +1012,13 @@ void ODBCConnection::UV_AfterQuery(uv_work_t* req, int status) {
   Nan::TryCatch try_catch;
 
   DEBUG_PRINTF("ODBCConnection::UV_AfterQuery : data->result=%i, data->noResultObject=%i\n", data->result, data->noResultObject);
+  
+  //keep a statement prepared here for the next query with the same SQL
+  if (data->prepared) {
+    data->cachedStmt = ODBC::AddCachedStatement(
+      &data->conn->statementCache, data->pool, data->hSTMT,
+      data->sql, data->sqlSize);
+  }
 
   // Retrieve values of INOUT and OUTPUT Parameters of Stored Procedure
   if (SQL_SUCCEEDED(data->result)) {
@@ -849,7 +1036,12 @@ void ODBCConnection::UV_AfterQuery(uv_work_t* req, int status) {
     //with Nan::True()
     
     DEBUG_PRINTF("Going to free handle.\n");
-    SQLFreeHandle(SQL_HANDLE_STMT, data->hSTMT);
+    if (data->cachedStmt) {
+      ODBC::ReleaseCachedStatement(data->cachedStmt);
+    }
+    else {
+      ODBC::ReleasePooledStatement(data->pool, data->hSTMT);
+    }
     data->hSTMT = (SQLHSTMT)NULL;
     DEBUG_PRINTF("Handle freed.\n");
     
@@ -862,15 +1054,33 @@ void ODBCConnection::UV_AfterQuery(uv_work_t* req, int status) {
     data->cb->Call(2, info);
   }
   else {
-    Local<Value> info[4];
-    bool* canFreeHandle = new bool(true);
+    Local<Value> info[7];
+    bool* canFreeHandle = new bool(data->cachedStmt == NULL);
+    int argc = 4;
     
     info[0] = Nan::New<External>((void*)(intptr_t)data->conn->m_hENV);
     info[1] = Nan::New<External>((void*)(intptr_t)data->conn->m_hDBC);
     info[2] = Nan::New<External>((void*)(intptr_t)data->hSTMT);
     info[3] = Nan::New<External>((void*)canFreeHandle);
     
-    Local<Object> js_result = Nan::New<Function>(ODBCResult::constructor)->NewInstance(4, info);
+    //the result hands a cached statement back when it is closed
+    if (data->cachedStmt) {
+      ShapeCache* shapeCache = data->cachedStmt->shapeCache;
+      
+      info[4] = shapeCache ? (Local<Value>) Nan::New<External>((void*)shapeCache)
+                           : (Local<Value>) Nan::Null();
+      info[5] = Nan::New<External>((void*)data->cachedStmt);
+      argc = 6;
+    }
+    //and other handles to the pool they came from
+    else if (data->pool) {
+      info[4] = Nan::Null();
+      info[5] = Nan::Null();
+      info[6] = Nan::New<External>((void*)data->pool);
+      argc = 7;
+    }
+    
+    Local<Object> js_result = Nan::New<Function>(ODBCResult::constructor)->NewInstance(argc, info);
 
     // Check now to see if there was an error (as there may be further result sets)
     if (data->result == SQL_ERROR) {
@@ -894,9 +1104,8 @@ void ODBCConnection::UV_AfterQuery(uv_work_t* req, int status) {
   
   delete data->cb;
 
-  if (data->paramCount) {
-      FREE_PARAMS( data->params, data->paramCount ) ;
-  }
+  //the block of the parameters is there for the next query to fill
+  ODBC::FreeParameters(data->params, &data->conn->paramArena);
 
   free(data->sql);
   free(data->catalog);
@@ -927,13 +1136,14 @@ NAN_METHOD(ODBCConnection::QuerySync) {
 
   ODBCConnection* conn = Nan::ObjectWrap::Unwrap<ODBCConnection>(info.Holder());
   
-  Parameter* params = new Parameter[0];
+  Parameter* params = NULL;
   SQLRETURN ret;
   SQLHSTMT hSTMT;
   int paramCount = 0;
   int outParamCount = 0; // Non-zero tells its a SP.
   Local<Array> sp_result = Nan::New<Array>();
   bool noResultObject = false;
+  bool badParams = false;
   
   //Check arguments for different variations of calling this function
   if (info.Length() == 2) {
@@ -952,7 +1162,10 @@ NAN_METHOD(ODBCConnection::QuerySync) {
 
     params = ODBC::GetParametersFromArray(
       Local<Array>::Cast(info[1]),
-      &paramCount);
+      &paramCount,
+      &conn->paramArena,
+      &conn->paramDescriptors);
+    badParams = !params;
 
   }
   else if (info.Length() == 1 ) {
@@ -996,7 +1209,10 @@ NAN_METHOD(ODBCConnection::QuerySync) {
       if (obj->Has(optionParamsKey) && obj->Get(optionParamsKey)->IsArray()) {
         params = ODBC::GetParametersFromArray(
           Local<Array>::Cast(obj->Get(optionParamsKey)),
-          &paramCount);
+          &paramCount,
+          &conn->paramArena,
+          &conn->paramDescriptors);
+        badParams = !params;
       }
       else {
         paramCount = 0;
@@ -1020,10 +1236,46 @@ NAN_METHOD(ODBCConnection::QuerySync) {
   }
   //Done checking arguments
 
-  //allocate a new statment handle
-  ret = SQLAllocHandle( SQL_HANDLE_STMT, 
-                  conn->m_hDBC, 
-                  &hSTMT );
+  //streams are read by the execute of a prepared statement only
+  if (!badParams && ODBC::HasStreamParameters(params, paramCount)) {
+    ODBC::FreeParameters(params, &conn->paramArena);
+    Nan::ThrowTypeError("ODBCConnection::QuerySync(): stream parameters can "
+                        "only be sent by ODBCStatement::Execute or "
+                        "ExecuteNonQuery.");
+    badParams = true;
+  }
+
+  //a malformed parameter has thrown already
+  if (badParams) {
+    delete sql;
+    return;
+  }
+
+  CachedStatement* cachedStmt = NULL;
+  int sqlSize = (sql->length() + 1) * sizeof(SQLTCHAR);
+  
+  //reuse a statement an earlier query with the same SQL prepared
+  if (paramCount) {
+    cachedStmt = ODBC::GetCachedStatement(
+      &conn->statementCache, (void *) **sql, sqlSize);
+  }
+  
+  StatementPool* pool = cachedStmt ? NULL : conn->statementPool;
+  
+  if (cachedStmt) {
+    //already prepared, only the parameters change
+    hSTMT = cachedStmt->hSTMT;
+    ret = SQL_SUCCESS;
+  }
+  else if ((hSTMT = ODBC::TakePooledStatement(pool))) {
+    ret = SQL_SUCCESS;
+  }
+  else {
+    //allocate a new statment handle
+    ret = SQLAllocHandle( SQL_HANDLE_STMT, 
+                    conn->m_hDBC, 
+                    &hSTMT );
+  }
 
   DEBUG_PRINTF("ODBCConnection::QuerySync - hSTMT=%i, noResultObject=%i\n", hSTMT, noResultObject);
   //check to see if should excute a direct or a parameter bound query
@@ -1039,10 +1291,18 @@ NAN_METHOD(ODBCConnection::QuerySync) {
   }
   else {
     // prepare statement, bind parameters and execute statement
-    ret = SQLPrepare(
-      hSTMT,
-      (SQLTCHAR *) **sql, 
-      sql->length());
+    if (!cachedStmt) {
+      ret = SQLPrepare(
+        hSTMT,
+        (SQLTCHAR *) **sql, 
+        sql->length());
+      
+      //keep it prepared for the next query with the same SQL
+      if (SQL_SUCCEEDED(ret)) {
+        cachedStmt = ODBC::AddCachedStatement(
+          &conn->statementCache, pool, hSTMT, (void *) **sql, sqlSize);
+      }
+    }
     
     if (ret == SQL_SUCCESS || ret == SQL_SUCCESS_WITH_INFO) {
       ret = ODBC::BindParameters( hSTMT, params, paramCount ) ;
@@ -1058,9 +1318,11 @@ NAN_METHOD(ODBCConnection::QuerySync) {
         }
       }
     }
-    FREE_PARAMS( params, paramCount ) ;
   }
   
+  //the block of the parameters is there for the next query to fill
+  ODBC::FreeParameters(params, &conn->paramArena);
+  
   delete sql;
   
   //check to see if there was an error during execution
@@ -1071,7 +1333,12 @@ NAN_METHOD(ODBCConnection::QuerySync) {
       hSTMT,
       (char *) "[node-ibm_db] Error in ODBCConnection::QuerySync while executing query."
     );
-    SQLFreeHandle(SQL_HANDLE_STMT, hSTMT);
+    if (cachedStmt) {
+      ODBC::ReleaseCachedStatement(cachedStmt);
+    }
+    else {
+      ODBC::ReleasePooledStatement(pool, hSTMT);
+    }
     hSTMT = (SQLHSTMT)NULL;
     Nan::ThrowError(err);
     return;
@@ -1079,7 +1346,12 @@ NAN_METHOD(ODBCConnection::QuerySync) {
   else if (noResultObject) {
     //if there is not result object requested then
     //we must destroy the STMT ourselves.
-    SQLFreeHandle(SQL_HANDLE_STMT, hSTMT);
+    if (cachedStmt) {
+      ODBC::ReleaseCachedStatement(cachedStmt);
+    }
+    else {
+      ODBC::ReleasePooledStatement(pool, hSTMT);
+    }
     hSTMT = (SQLHSTMT)NULL;
 
     if( outParamCount ) // Its a CALL stmt with OUT params.
@@ -1093,15 +1365,33 @@ NAN_METHOD(ODBCConnection::QuerySync) {
     }
   }
   else {
-    Local<Value> result[4];
-    bool* canFreeHandle = new bool(true);
+    Local<Value> result[7];
+    bool* canFreeHandle = new bool(cachedStmt == NULL);
+    int argc = 4;
     
     result[0] = Nan::New<External>((void*) (intptr_t) conn->m_hENV);
     result[1] = Nan::New<External>((void*) (intptr_t) conn->m_hDBC);
     result[2] = Nan::New<External>((void*) (intptr_t) hSTMT);
     result[3] = Nan::New<External>((void*)canFreeHandle);
     
-    Local<Object> js_result = Nan::New<Function>(ODBCResult::constructor)->NewInstance(4, result);
+    //the result hands a cached statement back when it is closed
+    if (cachedStmt) {
+      ShapeCache* shapeCache = cachedStmt->shapeCache;
+      
+      result[4] = shapeCache ? (Local<Value>) Nan::New<External>((void*)shapeCache)
+                             : (Local<Value>) Nan::Null();
+      result[5] = Nan::New<External>((void*)cachedStmt);
+      argc = 6;
+    }
+    //and other handles to the pool they came from
+    else if (pool) {
+      result[4] = Nan::Null();
+      result[5] = Nan::Null();
+      result[6] = Nan::New<External>((void*)pool);
+      argc = 7;
+    }
+    
+    Local<Object> js_result = Nan::New<Function>(ODBCResult::constructor)->NewInstance(argc, result);
 
     if( outParamCount ) // Its a CALL stmt with OUT params.
     { // Return an array with outparams as second element. [result, outparams]
@@ -1194,6 +1484,8 @@ NAN_METHOD(ODBCConnection::Tables) {
   }
   
   data->conn = conn;
+  data->pool = conn->statementPool;
+  data->hSTMT = ODBC::TakePooledStatement(data->pool);
   work_req->data = data;
   
   uv_queue_work(
@@ -1210,7 +1502,9 @@ NAN_METHOD(ODBCConnection::Tables) {
 void ODBCConnection::UV_Tables(uv_work_t* req) {
   query_work_data* data = (query_work_data *)(req->data);
   
-  SQLAllocHandle(SQL_HANDLE_STMT, data->conn->m_hDBC, &data->hSTMT );
+  if (!data->hSTMT) {
+    SQLAllocHandle(SQL_HANDLE_STMT, data->conn->m_hDBC, &data->hSTMT );
+  }
   
   SQLRETURN ret = SQLTables( 
     data->hSTMT, 
@@ -1305,6 +1599,8 @@ NAN_METHOD(ODBCConnection::Columns) {
   }
   
   data->conn = conn;
+  data->pool = conn->statementPool;
+  data->hSTMT = ODBC::TakePooledStatement(data->pool);
   work_req->data = data;
   
   uv_queue_work(
@@ -1321,7 +1617,9 @@ NAN_METHOD(ODBCConnection::Columns) {
 void ODBCConnection::UV_Columns(uv_work_t* req) {
   query_work_data* data = (query_work_data *)(req->data);
   
-  SQLAllocHandle(SQL_HANDLE_STMT, data->conn->m_hDBC, &data->hSTMT );
+  if (!data->hSTMT) {
+    SQLAllocHandle(SQL_HANDLE_STMT, data->conn->m_hDBC, &data->hSTMT );
+  }
   
   SQLRETURN ret = SQLColumns( 
     data->hSTMT, 
@@ -48,6 +48,12 @@ class ODBCConnection : public Nan::ObjectWrap {
     static NAN_GETTER(ConnectedGetter);
     static NAN_GETTER(ConnectTimeoutGetter);
     static NAN_SETTER(ConnectTimeoutSetter);
+    static NAN_GETTER(StatementCacheSizeGetter);
+    static NAN_SETTER(StatementCacheSizeSetter);
+    static NAN_GETTER(StatementCacheStatsGetter);
+    static NAN_GETTER(StatementPoolSizeGetter);
+    static NAN_SETTER(StatementPoolSizeSetter);
+    static NAN_GETTER(StatementPoolStatsGetter);
 
     //async methods
     static NAN_METHOD(BeginTransaction);
@@ -106,24 +112,35 @@ class ODBCConnection : public Nan::ObjectWrap {
     bool connected;
     int statements;
     int connectTimeout;
+    StatementCache statementCache;
+    StatementPool *statementPool;  // made on open, closed with the connection
+    int statementPoolSize;
+    Parameter *paramArena;  // spare block for the parameters of a query
+    ParameterDescriptorCache paramDescriptors;  // of parameter objects queried
+    
+    void FreeStatements();
 };
 
 struct create_statement_work_data {
   Nan::Callback* cb;
   ODBCConnection *conn;
-  SQLHSTMT hSTMT;
+  SQLHSTMT hSTMT;                 // from the pool, or allocated by the worker
+  StatementPool *pool;
   int result;
 };
 
 struct query_work_data {
   Nan::Callback* cb;
   ODBCConnection *conn;
-  SQLHSTMT hSTMT;
+  SQLHSTMT hSTMT;                 // from the pool, or allocated by the worker
+  StatementPool *pool;
   
   Parameter *params;
   int paramCount;
   int completionType;
   bool noResultObject;
+  bool prepared;                  // hSTMT was prepared here and may be cached
+  CachedStatement *cachedStmt;    // the statement cache's, NULL otherwise
   
   void *sql;
   void *catalog;
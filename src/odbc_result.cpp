@@ -31,6 +31,8 @@ using namespace node;
 
 Nan::Persistent<Function> ODBCResult::constructor;
 Nan::Persistent<String> ODBCResult::OPTION_FETCH_MODE;
+Nan::Persistent<String> ODBCResult::OPTION_FETCH_SIZE;
+Nan::Persistent<String> ODBCResult::OPTION_STREAM_LOBS;
 
 void ODBCResult::Init(v8::Handle<Object> exports) {
   DEBUG_PRINTF("ODBCResult::Init\n");
@@ -48,6 +50,9 @@ void ODBCResult::Init(v8::Handle<Object> exports) {
   // Prototype Methods
   Nan::SetPrototypeMethod(constructor_template, "fetchAll", FetchAll);
   Nan::SetPrototypeMethod(constructor_template, "fetch", Fetch);
+  Nan::SetPrototypeMethod(constructor_template, "fetchN", FetchN);
+  Nan::SetPrototypeMethod(constructor_template, "forEach", ForEach);
+  Nan::SetPrototypeMethod(constructor_template, "getData", GetData);
 
   Nan::SetPrototypeMethod(constructor_template, "moreResultsSync", MoreResultsSync);
   Nan::SetPrototypeMethod(constructor_template, "closeSync", CloseSync);
@@ -58,6 +63,14 @@ void ODBCResult::Init(v8::Handle<Object> exports) {
   // Properties
   OPTION_FETCH_MODE.Reset(Nan::New("fetchMode").ToLocalChecked());
   Nan::SetAccessor(instance_template, Nan::New("fetchMode").ToLocalChecked(), FetchModeGetter, FetchModeSetter);
+  OPTION_FETCH_SIZE.Reset(Nan::New("fetchSize").ToLocalChecked());
+  Nan::SetAccessor(instance_template, Nan::New("fetchSize").ToLocalChecked(), FetchSizeGetter, FetchSizeSetter);
+  OPTION_STREAM_LOBS.Reset(Nan::New("streamLobs").ToLocalChecked());
+  Nan::SetAccessor(instance_template, Nan::New("bigintMode").ToLocalChecked(), BigintModeGetter, BigintModeSetter);
+  Nan::SetAccessor(instance_template, Nan::New("decimalMode").ToLocalChecked(), DecimalModeGetter, DecimalModeSetter);
+  Nan::SetAccessor(instance_template, Nan::New("charMode").ToLocalChecked(), CharModeGetter, CharModeSetter);
+  Nan::SetAccessor(instance_template, Nan::New("lazyRows").ToLocalChecked(), LazyRowsGetter, LazyRowsSetter);
+  Nan::SetAccessor(instance_template, Nan::New("rowGeneration").ToLocalChecked(), RowGenerationGetter);
   
   // Attach the Database Constructor to the target object
   constructor.Reset(constructor_template->GetFunction());
@@ -73,8 +86,40 @@ ODBCResult::~ODBCResult() {
 void ODBCResult::Free() {
   DEBUG_PRINTF("ODBCResult::Free m_hSTMT=%X m_canFreeHandle=%X\n", m_hSTMT, m_canFreeHandle);
   
-  if (m_hSTMT && m_canFreeHandle) {
-    SQLFreeHandle( SQL_HANDLE_STMT, m_hSTMT);
+  if (block) {
+    //a closed result's handle may be another result's by now
+    ODBC::FreeRowBlock(m_closed ? NULL : m_hSTMT, block);
+    block = NULL;
+  }
+
+  if (rowData) {
+    ODBC::FreeRowBuffer(rowData);
+    rowData = NULL;
+  }
+
+  if (shape && !(shapeCache && shape == shapeCache->shape)) {
+    ODBC::FreeRowShape(shape);
+  }
+  shape = NULL;
+
+  if (shapeCache) {
+    if (columns == shapeCache->columns) {
+      columns = NULL;
+      colCount = 0;
+    }
+    ODBC::ReleaseShapeCache(shapeCache);
+    shapeCache = NULL;
+  }
+
+  if (cachedStatement) {
+    //the connection keeps the handle prepared for the next query
+    ODBC::ReleaseCachedStatement(cachedStatement);
+    cachedStatement = NULL;
+    m_hSTMT = (SQLHSTMT)NULL;
+  }
+  else if (m_hSTMT && m_canFreeHandle) {
+    ODBC::ReleasePooledStatement(statementPool, m_hSTMT);
+    statementPool = NULL;
     m_hSTMT = (SQLHSTMT)NULL;
   }
   
@@ -112,6 +157,31 @@ NAN_METHOD(ODBCResult::New) {
   
   //free the pointer to canFreeHandle
   delete canFreeHandle;
+  
+  //results of a prepared statement share its column descriptions
+  objODBCResult->shapeCache = NULL;
+  
+  if (info.Length() > 4 && info[4]->IsExternal()) {
+    objODBCResult->shapeCache = static_cast<ShapeCache *>(
+      Local<External>::Cast(info[4])->Value());
+    objODBCResult->shapeCache->refs++;
+  }
+  
+  //a statement from the connection's cache goes back there on close
+  objODBCResult->cachedStatement = NULL;
+  
+  if (info.Length() > 5 && info[5]->IsExternal()) {
+    objODBCResult->cachedStatement = static_cast<CachedStatement *>(
+      Local<External>::Cast(info[5])->Value());
+  }
+  
+  //and a handle from the connection's pool goes back to the pool
+  objODBCResult->statementPool = NULL;
+  
+  if (info.Length() > 6 && info[6]->IsExternal()) {
+    objODBCResult->statementPool = static_cast<StatementPool *>(
+      Local<External>::Cast(info[6])->Value());
+  }
 
   //specify the buffer length
   objODBCResult->bufferLength = MAX_VALUE_SIZE;
@@ -122,10 +192,30 @@ NAN_METHOD(ODBCResult::New) {
 
   //set the initial colCount to 0
   objODBCResult->colCount = 0;
+  objODBCResult->columns = NULL;
+  objODBCResult->block = NULL;
+  objODBCResult->rowData = NULL;
+  objODBCResult->shape = NULL;
+  objODBCResult->lobColumn = -1;
+  objODBCResult->rowGeneration = 0;
+  objODBCResult->getDataChecked = false;
+  objODBCResult->m_closed = false;
+  objODBCResult->lobCarry = 0;
 
   //default fetchMode to FETCH_OBJECT
   objODBCResult->m_fetchMode = FETCH_OBJECT;
   
+  //default number of rows fetchAll buffers per trip to the thread pool
+  objODBCResult->m_fetchSize = FETCH_SIZE;
+  
+  //BIGINT and DECIMAL values are returned as strings by default
+  objODBCResult->m_bigintMode = BIGINT_STRING;
+  objODBCResult->m_decimalMode = DECIMAL_STRING;
+  objODBCResult->m_charMode = CHAR_WIDE;
+  
+  //rows are decoded in full unless lazyRows is set
+  objODBCResult->m_lazyRows = false;
+  
   objODBCResult->Wrap(info.Holder());
   
   info.GetReturnValue().Set(info.Holder());
@@ -149,6 +239,116 @@ NAN_SETTER(ODBCResult::FetchModeSetter) {
   }
 }
 
+NAN_GETTER(ODBCResult::FetchSizeGetter) {
+  Nan::HandleScope scope;
+
+  ODBCResult *obj = Nan::ObjectWrap::Unwrap<ODBCResult>(info.Holder());
+
+  info.GetReturnValue().Set(Nan::New(obj->m_fetchSize));
+}
+
+NAN_SETTER(ODBCResult::FetchSizeSetter) {
+  Nan::HandleScope scope;
+
+  ODBCResult *obj = Nan::ObjectWrap::Unwrap<ODBCResult>(info.Holder());
+  
+  if (value->IsInt32() && value->Int32Value() > 0) {
+    obj->m_fetchSize = value->Int32Value();
+  }
+}
+
+NAN_GETTER(ODBCResult::BigintModeGetter) {
+  Nan::HandleScope scope;
+
+  ODBCResult *obj = Nan::ObjectWrap::Unwrap<ODBCResult>(info.Holder());
+
+  info.GetReturnValue().Set(Nan::New(obj->m_bigintMode));
+}
+
+NAN_SETTER(ODBCResult::BigintModeSetter) {
+  Nan::HandleScope scope;
+
+  ODBCResult *obj = Nan::ObjectWrap::Unwrap<ODBCResult>(info.Holder());
+  
+  if (value->IsInt32()) {
+    obj->m_bigintMode = value->Int32Value();
+  }
+}
+
+NAN_GETTER(ODBCResult::DecimalModeGetter) {
+  Nan::HandleScope scope;
+
+  ODBCResult *obj = Nan::ObjectWrap::Unwrap<ODBCResult>(info.Holder());
+
+  info.GetReturnValue().Set(Nan::New(obj->m_decimalMode));
+}
+
+NAN_SETTER(ODBCResult::DecimalModeSetter) {
+  Nan::HandleScope scope;
+
+  ODBCResult *obj = Nan::ObjectWrap::Unwrap<ODBCResult>(info.Holder());
+  
+  if (value->IsInt32()) {
+    obj->m_decimalMode = value->Int32Value();
+  }
+}
+
+NAN_GETTER(ODBCResult::CharModeGetter) {
+  Nan::HandleScope scope;
+
+  ODBCResult *obj = Nan::ObjectWrap::Unwrap<ODBCResult>(info.Holder());
+
+  info.GetReturnValue().Set(Nan::New(obj->m_charMode));
+}
+
+NAN_SETTER(ODBCResult::CharModeSetter) {
+  Nan::HandleScope scope;
+
+  ODBCResult *obj = Nan::ObjectWrap::Unwrap<ODBCResult>(info.Holder());
+  
+  if (value->IsInt32()) {
+    obj->m_charMode = value->Int32Value();
+  }
+  
+  //SQL_C_CHAR data is only UTF-8 when the client code page is 1208, so stay
+  //with wide characters on any other
+  if (obj->m_charMode == CHAR_UTF8) {
+    SQLINTEGER codepage = 0;
+    SQLRETURN ret = SQLGetConnectAttr(obj->m_hDBC, SQL_ATTR_CLIENT_CODEPAGE,
+                                      &codepage, 0, NULL);
+    
+    if (!SQL_SUCCEEDED(ret) || codepage != UTF8_CODEPAGE) {
+      DEBUG_PRINTF("ODBCResult::CharModeSetter: client code page %i, using "
+                   "CHAR_WIDE\n", (int) codepage);
+      obj->m_charMode = CHAR_WIDE;
+    }
+  }
+}
+
+NAN_GETTER(ODBCResult::RowGenerationGetter) {
+  Nan::HandleScope scope;
+
+  ODBCResult *obj = Nan::ObjectWrap::Unwrap<ODBCResult>(info.Holder());
+
+  info.GetReturnValue().Set(Nan::New<Number>(obj->rowGeneration));
+}
+
+NAN_GETTER(ODBCResult::LazyRowsGetter) {
+  Nan::HandleScope scope;
+
+  ODBCResult *obj = Nan::ObjectWrap::Unwrap<ODBCResult>(info.Holder());
+
+  info.GetReturnValue().Set(Nan::New(obj->m_lazyRows));
+}
+
+NAN_SETTER(ODBCResult::LazyRowsSetter) {
+  Nan::HandleScope scope;
+
+  ODBCResult *obj = Nan::ObjectWrap::Unwrap<ODBCResult>(info.Holder());
+  
+  obj->m_lazyRows = value->BooleanValue();
+}
+
 /*
  * Fetch
  */
@@ -182,6 +382,29 @@ NAN_METHOD(ODBCResult::Fetch) {
     if (obj->Has(fetchModeKey) && obj->Get(fetchModeKey)->IsInt32()) {
       data->fetchMode = obj->Get(fetchModeKey)->ToInt32()->Value();
     }
+    
+    Local<String> streamLobsKey = Nan::New<String>(OPTION_STREAM_LOBS);
+    if (obj->Has(streamLobsKey)) {
+      Local<Value> streamLobs = obj->Get(streamLobsKey);
+      
+      //an Array of column positions picks the LOBs to stream
+      if (streamLobs->IsArray()) {
+        Local<Array> list = Local<Array>::Cast(streamLobs);
+        
+        data->streamLobs = true;
+        data->lobColumnCount = list->Length();
+        data->lobColumns = (int *) malloc(
+          (data->lobColumnCount + 1) * sizeof(int));
+        MEMCHECK( data->lobColumns );
+        
+        for (int i = 0; i < data->lobColumnCount; i++) {
+          data->lobColumns[i] = list->Get(i)->Int32Value();
+        }
+      }
+      else {
+        data->streamLobs = streamLobs->BooleanValue();
+      }
+    }
   }
   else {
     return Nan::ThrowTypeError("ODBCResult::Fetch(): 1 or 2 arguments are required. The last argument must be a callback function.");
@@ -193,6 +416,8 @@ NAN_METHOD(ODBCResult::Fetch) {
   data->objResult = objODBCResult;
   work_req->data = data;
   
+  objODBCResult->ForgetLobs();
+  
   uv_queue_work(
     uv_default_loop(), 
     work_req, 
@@ -209,7 +434,66 @@ void ODBCResult::UV_Fetch(uv_work_t* work_req) {
   
   fetch_work_data* data = (fetch_work_data *)(work_req->data);
   
-  data->result = SQLFetch(data->objResult->m_hSTMT);
+  ODBCResult* self = data->objResult->self();
+  
+  //read the row into native memory here so that the loop thread does not
+  //have to wait on SQLGetData
+  if (self->colCount == 0) {
+    self->DescribeColumns();
+  }
+  
+  //a block left bound by fetchN has been handed out in full, rows are
+  //fetched one at a time from here on
+  if (self->block) {
+    ODBC::FreeRowBlock(self->m_hSTMT, self->block);
+    self->block = NULL;
+  }
+  
+  //the LOB columns left for GetData, all of them or the ones picked
+  bool *stream = NULL;
+  
+  if (data->streamLobs && self->colCount > 0) {
+    stream = new bool[self->colCount];
+    
+    for (int i = 0; i < self->colCount; i++) {
+      stream[i] = (data->lobColumns == NULL);
+    }
+    
+    for (int i = 0; data->lobColumns && i < data->lobColumnCount; i++) {
+      if (data->lobColumns[i] >= 0 && data->lobColumns[i] < self->colCount) {
+        stream[data->lobColumns[i]] = true;
+      }
+    }
+    
+    for (int i = 0; i < self->colCount; i++) {
+      stream[i] = stream[i] && ODBC::IsStreamableLob(&self->columns[i]);
+    }
+  }
+  
+  if (self->rowData &&
+      ((self->rowData->deferred == NULL) != (stream == NULL) ||
+       (stream && memcmp(self->rowData->deferred, stream,
+                         self->colCount * sizeof(bool))))) {
+    ODBC::FreeRowBuffer(self->rowData);
+    self->rowData = NULL;
+  }
+  
+  if (self->colCount > 0 && self->rowData == NULL) {
+    ODBC::SetNumericTypes(self->columns, self->colCount,
+                          self->m_bigintMode, self->m_decimalMode);
+    ODBC::SetCharTypes(self->columns, self->colCount, self->m_charMode);
+    self->rowData = ODBC::NewRowBuffer(self->columns, self->colCount, stream);
+  }
+  
+  delete [] stream;
+  
+  if (self->rowData) {
+    data->result = ODBC::FetchRowBuffer(self->m_hSTMT, self->columns,
+                                        self->rowData, 1);
+  }
+  else {
+    data->result = SQLFetch(self->m_hSTMT);
+  }
 }
 
 void ODBCResult::UV_AfterFetch(uv_work_t* work_req, int status) {
@@ -218,6 +502,8 @@ void ODBCResult::UV_AfterFetch(uv_work_t* work_req, int status) {
   
   fetch_work_data* data = (fetch_work_data *)(work_req->data);
   
+  ODBCResult* self = data->objResult->self();
+  
   SQLRETURN ret = data->result;
   //TODO: we should probably define this on the work data so we
   //don't have to keep creating it?
@@ -225,14 +511,8 @@ void ODBCResult::UV_AfterFetch(uv_work_t* work_req, int status) {
   bool moreWork = true;
   bool error = false;
   
-  if (data->objResult->colCount == 0) {
-    data->objResult->columns = ODBC::GetColumns(
-      data->objResult->m_hSTMT, 
-      &data->objResult->colCount);
-  }
-  
   //check to see if the result has no columns
-  if (data->objResult->colCount == 0) {
+  if (self->colCount == 0) {
     //this means
     moreWork = false;
   }
@@ -241,10 +521,16 @@ void ODBCResult::UV_AfterFetch(uv_work_t* work_req, int status) {
     moreWork = false;
     error = true;
     
-    objError = ODBC::GetSQLError(
-      SQL_HANDLE_STMT, 
-      data->objResult->m_hSTMT,
-      (char *) "Error in ODBCResult::UV_AfterFetch");
+    if (self->rowData && self->rowData->outOfMemory) {
+      objError = Nan::Error("[node-odbc] Failed to allocate memory buffer "
+                            "for column data in ODBCResult::UV_AfterFetch");
+    }
+    else {
+      objError = ODBC::GetSQLError(
+        SQL_HANDLE_STMT, 
+        self->m_hSTMT,
+        (char *) "Error in ODBCResult::UV_AfterFetch");
+    }
   }
   //check to see if we are at the end of the recordset
   else if (ret == SQL_NO_DATA) {
@@ -253,23 +539,20 @@ void ODBCResult::UV_AfterFetch(uv_work_t* work_req, int status) {
 
   if (moreWork) {
     Local<Value> info[2];
+    size_t offset = 0;
 
     info[0] = Nan::Null();
     if (data->fetchMode == FETCH_ARRAY) {
-      info[1] = ODBC::GetRecordArray(
-        data->objResult->m_hSTMT,
-        data->objResult->columns,
-        &data->objResult->colCount,
-        data->objResult->buffer,
-        data->objResult->bufferLength);
+      info[1] = ODBC::GetBufferedRecordArray(
+        self->rowData,
+        self->columns,
+        &offset);
     }
     else {
-      info[1] = ODBC::GetRecordTuple(
-        data->objResult->m_hSTMT,
-        data->objResult->columns,
-        &data->objResult->colCount,
-        data->objResult->buffer,
-        data->objResult->bufferLength);
+      info[1] = ODBC::GetBufferedRecordTuple(
+        self->rowData,
+        self->GetShape(),
+        &offset);
     }
 
     Nan::TryCatch try_catch;
@@ -282,7 +565,7 @@ void ODBCResult::UV_AfterFetch(uv_work_t* work_req, int status) {
     }
   }
   else {
-    ODBC::FreeColumns(data->objResult->columns, &data->objResult->colCount);
+    self->FreeBuffers();
     
     Local<Value> info[2];
     
@@ -308,12 +591,229 @@ void ODBCResult::UV_AfterFetch(uv_work_t* work_req, int status) {
   
   data->objResult->Unref();
   
+  free(data->lobColumns);
   free(data);
   free(work_req);
   
   return;
 }
 
+/*
+ * GetData
+ *
+ * Reads the next chunk of up to size bytes of a LOB column that
+ * fetch({ streamLobs : true }) left unread in the current row. The callback
+ * gets a Buffer for a binary LOB, a string for a character LOB, and null
+ * once the whole value has been read.
+ */
+
+NAN_METHOD(ODBCResult::GetData) {
+  DEBUG_PRINTF("ODBCResult::GetData\n");
+  Nan::HandleScope scope;
+  
+  ODBCResult* objODBCResult = Nan::ObjectWrap::Unwrap<ODBCResult>(info.Holder());
+  
+  if (info.Length() != 4 || !info[0]->IsInt32() || !info[1]->IsInt32() ||
+      !info[2]->IsNumber() || !info[3]->IsFunction()) {
+    return Nan::ThrowTypeError("ODBCResult::GetData(): 4 arguments are required: "
+                               "column, size, rowGeneration and a callback "
+                               "function.");
+  }
+  
+  int column = info[0]->Int32Value();
+  int size = info[1]->Int32Value();
+  RowBuffer *rows = objODBCResult->rowData;
+  
+  if (info[2]->NumberValue() != objODBCResult->rowGeneration) {
+    return Nan::ThrowError("ODBCResult::GetData(): the cursor has moved off "
+                           "the row of this LOB.");
+  }
+  
+  //SQLGetData on another column drops the place in this one
+  if (objODBCResult->lobColumn != -1 && objODBCResult->lobColumn != column) {
+    return Nan::ThrowError("ODBCResult::GetData(): the LOBs of a row are read "
+                           "one at a time, and another one has not been read "
+                           "to the end.");
+  }
+  
+  if (rows == NULL || rows->deferred == NULL || rows->rowCount == 0 ||
+      column < 0 || column >= rows->colCount || !rows->deferred[column]) {
+    return Nan::ThrowError("ODBCResult::GetData(): the column is not a LOB "
+                           "left unread by fetch({ streamLobs : true }).");
+  }
+  
+  if (size <= 0) {
+    return Nan::ThrowTypeError("ODBCResult::GetData(): size must be positive.");
+  }
+  
+  //FetchRowBuffer has read every column of the row, so going back to any
+  //but the last one takes a driver with SQL_GD_ANY_ORDER
+  if (!objODBCResult->getDataChecked) {
+    SQLUINTEGER extensions = 0;
+    
+    if (!SQL_SUCCEEDED(SQLGetInfo(objODBCResult->m_hDBC,
+                                  SQL_GETDATA_EXTENSIONS,
+                                  &extensions, sizeof(extensions), NULL))) {
+      extensions = 0;
+    }
+    
+    objODBCResult->getDataExtensions = extensions;
+    objODBCResult->getDataChecked = true;
+  }
+  
+  if (!(objODBCResult->getDataExtensions & SQL_GD_ANY_ORDER) &&
+      column != rows->colCount - 1) {
+    return Nan::ThrowError("ODBCResult::GetData(): the driver reads the "
+                           "columns of a row in order only (no "
+                           "SQL_GD_ANY_ORDER), so only a LOB in the last "
+                           "column can be streamed.");
+  }
+  
+  uv_work_t* work_req = (uv_work_t *) (calloc(1, sizeof(uv_work_t)));
+  MEMCHECK( work_req );
+  
+  getdata_work_data* data = (getdata_work_data *) calloc(1, sizeof(getdata_work_data));
+  MEMCHECK( data );
+  
+  data->column = column;
+  data->c_type = rows->c_types[column];
+  data->bufferLength = size;
+  
+  if (data->c_type == SQL_C_WCHAR) {
+    //whole code units, at least two so that one is left after holding back
+    //a high surrogate, then room for a carried over unit and the terminator
+    data->bufferLength = (size < 4) ? 4 : (size & ~1);
+    data->bufferLength += 2 * sizeof(uint16_t);
+  }
+  
+  data->buffer = (char *) malloc(data->bufferLength);
+  MEMCHECK( data->buffer );
+  
+  objODBCResult->lobColumn = column;
+  
+  if (objODBCResult->lobCarry) {
+    *(uint16_t *) data->buffer = objODBCResult->lobCarry;
+    data->offset = sizeof(uint16_t);
+    objODBCResult->lobCarry = 0;
+  }
+  
+  data->generation = objODBCResult->rowGeneration;
+  data->cb = new Nan::Callback(Local<Function>::Cast(info[3]));
+  data->objResult = objODBCResult;
+  work_req->data = data;
+  
+  uv_queue_work(
+    uv_default_loop(), 
+    work_req, 
+    UV_GetData, 
+    (uv_after_work_cb)UV_AfterGetData);
+
+  objODBCResult->Ref();
+
+  info.GetReturnValue().Set(Nan::Undefined());
+}
+
+void ODBCResult::UV_GetData(uv_work_t* work_req) {
+  DEBUG_PRINTF("ODBCResult::UV_GetData\n");
+  
+  getdata_work_data* data = (getdata_work_data *)(work_req->data);
+  
+  ODBCResult* self = data->objResult->self();
+  
+  SQLLEN ind = 0;
+  SQLLEN terCharLen = (data->c_type == SQL_C_WCHAR) ? sizeof(uint16_t) : 0;
+  SQLLEN room = data->bufferLength - data->offset - terCharLen;
+  
+  data->result = SQLGetData( self->m_hSTMT,
+                             self->columns[data->column].index,
+                             data->c_type,
+                             data->buffer + data->offset,
+                             data->bufferLength - data->offset,
+                             &ind);
+  
+  data->len = data->offset;
+  
+  if (SQL_SUCCEEDED(data->result) && ind != SQL_NULL_DATA) {
+    if (data->result == SQL_SUCCESS_WITH_INFO &&
+        (ind == SQL_NO_TOTAL || ind > room)) {
+      data->len += room;
+      data->more = true;
+    }
+    else {
+      data->len += ind;
+    }
+  }
+  
+  DEBUG_PRINTF("ODBCResult::UV_GetData column=%i ret=%i len=%i\n",
+               data->column, data->result, data->len);
+}
+
+void ODBCResult::UV_AfterGetData(uv_work_t* work_req, int status) {
+  DEBUG_PRINTF("ODBCResult::UV_AfterGetData\n");
+  Nan::HandleScope scope;
+  
+  getdata_work_data* data = (getdata_work_data *)(work_req->data);
+  
+  ODBCResult* self = data->objResult->self();
+  
+  //unless the cursor moved meanwhile, the column stays the one being read
+  //until its value has been read to the end
+  bool current = (data->generation == self->rowGeneration);
+  bool more = data->more && SQL_SUCCEEDED(data->result);
+  
+  if (current) {
+    self->lobColumn = more ? data->column : -1;
+  }
+  
+  Local<Value> info[3];
+  
+  info[0] = Nan::Null();
+  info[1] = Nan::Null();
+  info[2] = Nan::New<Boolean>(more);
+  
+  if (!SQL_SUCCEEDED(data->result) && data->result != SQL_NO_DATA) {
+    info[0] = ODBC::GetSQLError(
+      SQL_HANDLE_STMT, 
+      self->m_hSTMT,
+      (char *) "[node-odbc] Error in ODBCResult::UV_AfterGetData");
+  }
+  else if (data->len > 0 && data->c_type == SQL_C_WCHAR) {
+    uint16_t *units = (uint16_t *) data->buffer;
+    SQLLEN count = data->len / sizeof(uint16_t);
+    
+    if (data->more && units[count - 1] >= 0xD800 && units[count - 1] <= 0xDBFF) {
+      count--;
+      
+      if (current) {
+        self->lobCarry = units[count];
+      }
+    }
+    
+    info[1] = ODBC::GetWideValue(units, count);
+  }
+  else if (data->len > 0) {
+    //the Buffer takes over the chunk
+    info[1] = Nan::NewBuffer(data->buffer, data->len).ToLocalChecked();
+    data->buffer = NULL;
+  }
+  
+  free(data->buffer);
+  
+  Nan::TryCatch try_catch;
+
+  data->cb->Call(3, info);
+  delete data->cb;
+
+  if (try_catch.HasCaught()) {
+    FatalException(try_catch);
+  }
+  
+  data->objResult->Unref();
+  
+  free(data);
+  free(work_req);
+}
+
 /*
  * FetchSync
  */
@@ -338,12 +838,17 @@ NAN_METHOD(ODBCResult::FetchSync) {
     }
   }
   
+  if (objResult->block) {
+    ODBC::FreeRowBlock(objResult->m_hSTMT, objResult->block);
+    objResult->block = NULL;
+  }
+  
+  objResult->ForgetLobs();
+  
   SQLRETURN ret = SQLFetch(objResult->m_hSTMT);
 
   if (objResult->colCount == 0) {
-    objResult->columns = ODBC::GetColumns(
-      objResult->m_hSTMT, 
-      &objResult->colCount);
+    objResult->DescribeColumns();
   }
   
   //check to see if the result has no columns
@@ -368,6 +873,13 @@ NAN_METHOD(ODBCResult::FetchSync) {
   if (moreWork) {
     Local<Value> data;
     
+    objResult->ReserveBuffer();
+    
+    ODBC::SetNumericTypes(objResult->columns, objResult->colCount,
+                          objResult->m_bigintMode, objResult->m_decimalMode);
+    ODBC::SetCharTypes(objResult->columns, objResult->colCount,
+                       objResult->m_charMode);
+    
     if (fetchMode == FETCH_ARRAY) {
       data = ODBC::GetRecordArray(
         objResult->m_hSTMT,
@@ -382,13 +894,14 @@ NAN_METHOD(ODBCResult::FetchSync) {
         objResult->columns,
         &objResult->colCount,
         objResult->buffer,
-        objResult->bufferLength);
+        objResult->bufferLength,
+        objResult->GetShape());
     }
     
     info.GetReturnValue().Set(data);
   }
   else {
-    ODBC::FreeColumns(objResult->columns, &objResult->colCount);
+    objResult->FreeBuffers();
 
     //if there was an error, pass that as arg[0] otherwise Null
     if (error) {
@@ -403,27 +916,178 @@ NAN_METHOD(ODBCResult::FetchSync) {
 }
 
 /*
- * FetchAll
+ * FetchN
+ *
+ * Fetches up to n rows in one trip to the thread pool and passes them to
+ * the callback as an array, which is empty once the result set is done.
+ * The block or row buffer stays bound between calls, so the next batch
+ * continues where this one stopped.
  */
 
-NAN_METHOD(ODBCResult::FetchAll) {
-  DEBUG_PRINTF("ODBCResult::FetchAll\n");
+NAN_METHOD(ODBCResult::FetchN) {
+  DEBUG_PRINTF("ODBCResult::FetchN\n");
   Nan::HandleScope scope;
   
   ODBCResult* objODBCResult = Nan::ObjectWrap::Unwrap<ODBCResult>(info.Holder());
   
-  uv_work_t* work_req = (uv_work_t *) (calloc(1, sizeof(uv_work_t)));
-  MEMCHECK( work_req );
-  
-  fetch_work_data* data = (fetch_work_data *) calloc(1, sizeof(fetch_work_data));
-  MEMCHECK( data );
-  
   Local<Function> cb;
+  int fetchMode = objODBCResult->m_fetchMode;
   
-  data->fetchMode = objODBCResult->m_fetchMode;
-  
-  if (info.Length() == 1 && info[0]->IsFunction()) {
-    cb = Local<Function>::Cast(info[0]);
+  if (info.Length() == 2 && info[0]->IsInt32() && info[1]->IsFunction()) {
+    cb = Local<Function>::Cast(info[1]);
+  }
+  else if (info.Length() == 3 && info[0]->IsInt32() && info[1]->IsObject() &&
+           info[2]->IsFunction()) {
+    cb = Local<Function>::Cast(info[2]);
+    
+    Local<Object> obj = info[1]->ToObject();
+    
+    Local<String> fetchModeKey = Nan::New<String>(OPTION_FETCH_MODE);
+    if (obj->Has(fetchModeKey) && obj->Get(fetchModeKey)->IsInt32()) {
+      fetchMode = obj->Get(fetchModeKey)->ToInt32()->Value();
+    }
+  }
+  else {
+    return Nan::ThrowTypeError("ODBCResult::FetchN(): 2 or 3 arguments are required. The first argument must be the number of rows and the last a callback function.");
+  }
+  
+  if (info[0]->Int32Value() < 1) {
+    return Nan::ThrowRangeError("ODBCResult::FetchN(): the number of rows must be at least 1.");
+  }
+  
+  uv_work_t* work_req = (uv_work_t *) (calloc(1, sizeof(uv_work_t)));
+  MEMCHECK( work_req );
+  
+  fetch_work_data* data = (fetch_work_data *) calloc(1, sizeof(fetch_work_data));
+  MEMCHECK( data );
+  
+  data->fetchMode = fetchMode;
+  data->fetchSize = info[0]->Int32Value();
+  data->cb = new Nan::Callback(cb);
+  data->objResult = objODBCResult;
+  
+  work_req->data = data;
+  
+  objODBCResult->ForgetLobs();
+  
+  uv_queue_work(uv_default_loop(),
+    work_req, 
+    UV_FetchN, 
+    (uv_after_work_cb)UV_AfterFetchN);
+
+  objODBCResult->Ref();
+
+  info.GetReturnValue().Set(Nan::Undefined());
+}
+
+void ODBCResult::UV_FetchN(uv_work_t* work_req) {
+  DEBUG_PRINTF("ODBCResult::UV_FetchN\n");
+  
+  fetch_work_data* data = (fetch_work_data *)(work_req->data);
+  
+  ODBCResult* self = data->objResult->self();
+  
+  //a block bound for another batch size would hand back too many or too
+  //few rows
+  if (self->block && self->block->fetchSize != data->fetchSize) {
+    ODBC::FreeRowBlock(self->m_hSTMT, self->block);
+    self->block = NULL;
+  }
+  
+  BindBuffers(self, data->fetchSize, data->fetchMode);
+  
+  data->result = FetchBuffers(self, data->fetchSize);
+  DEBUG_PRINTF("ODBCResult::UV_FetchN, return code = %d\n", data->result);
+}
+
+void ODBCResult::UV_AfterFetchN(uv_work_t* work_req, int status) {
+  DEBUG_PRINTF("ODBCResult::UV_AfterFetchN\n");
+  Nan::HandleScope scope;
+  
+  fetch_work_data* data = (fetch_work_data *)(work_req->data);
+  
+  ODBCResult* self = data->objResult->self();
+  
+  Local<Array> rows = Nan::New<Array>();
+  Local<Value> info[2];
+  bool done = false;
+  
+  info[0] = Nan::Null();
+  
+  //rows buffered before the end of the result set or an error still count
+  if (!GetBufferedRows(self, data->fetchMode, rows, &data->count,
+                       &data->columnSet)) {
+    info[0] = Nan::Error("[node-odbc] Failed to allocate memory for the "
+                         "columns in ODBCResult::UV_AfterFetchN");
+    done = true;
+  }
+  else if (self->colCount == 0 || data->result == SQL_NO_DATA) {
+    done = true;
+  }
+  else if (data->result == SQL_ERROR) {
+    if (self->rowData && self->rowData->outOfMemory) {
+      info[0] = Nan::Error("[node-odbc] Failed to allocate memory buffer "
+                           "for column data in ODBCResult::UV_AfterFetchN");
+    }
+    else {
+      info[0] = ODBC::GetSQLError(
+        SQL_HANDLE_STMT, 
+        self->m_hSTMT,
+        (char *) "[node-odbc] Error in ODBCResult::UV_AfterFetchN");
+    }
+    done = true;
+  }
+  
+  if (data->columnSet) {
+    info[1] = ODBC::GetColumnSetArray(data->columnSet, self->columns);
+    ODBC::FreeColumnSet(data->columnSet);
+  }
+  else {
+    info[1] = rows;
+  }
+  
+  if (done) {
+    self->FreeBuffers();
+  }
+  
+  Nan::TryCatch try_catch;
+
+  data->cb->Call(2, info);
+  delete data->cb;
+
+  if (try_catch.HasCaught()) {
+    FatalException(try_catch);
+  }
+
+  free(data);
+  free(work_req);
+
+  self->Unref();
+}
+
+/*
+ * FetchAll
+ */
+
+NAN_METHOD(ODBCResult::FetchAll) {
+  DEBUG_PRINTF("ODBCResult::FetchAll\n");
+  Nan::HandleScope scope;
+  
+  ODBCResult* objODBCResult = Nan::ObjectWrap::Unwrap<ODBCResult>(info.Holder());
+  
+  uv_work_t* work_req = (uv_work_t *) (calloc(1, sizeof(uv_work_t)));
+  MEMCHECK( work_req );
+  
+  fetch_work_data* data = (fetch_work_data *) calloc(1, sizeof(fetch_work_data));
+  MEMCHECK( data );
+  
+  Local<Function> cb;
+  
+  data->fetchMode = objODBCResult->m_fetchMode;
+  data->fetchSize = objODBCResult->m_fetchSize;
+  
+  if (info.Length() == 1 && info[0]->IsFunction()) {
+    cb = Local<Function>::Cast(info[0]);
   }
   else if (info.Length() == 2 && info[0]->IsObject() && info[1]->IsFunction()) {
     cb = Local<Function>::Cast(info[1]);  
@@ -434,11 +1098,17 @@ NAN_METHOD(ODBCResult::FetchAll) {
     if (obj->Has(fetchModeKey) && obj->Get(fetchModeKey)->IsInt32()) {
       data->fetchMode = obj->Get(fetchModeKey)->ToInt32()->Value();
     }
+    
+    Local<String> fetchSizeKey = Nan::New<String>(OPTION_FETCH_SIZE);
+    if (obj->Has(fetchSizeKey) && obj->Get(fetchSizeKey)->IsInt32()) {
+      data->fetchSize = obj->Get(fetchSizeKey)->ToInt32()->Value();
+    }
   }
   else {
     Nan::ThrowTypeError("ODBCResult::FetchAll(): 1 or 2 arguments are required. The last argument must be a callback function.");
   }
   
+  data->mode = MODE_COLLECT_AND_CALLBACK;
   data->rows.Reset(Nan::New<Array>());
   data->errorCount = 0;
   data->count = 0;
@@ -449,6 +1119,85 @@ NAN_METHOD(ODBCResult::FetchAll) {
   
   work_req->data = data;
   
+  objODBCResult->ForgetLobs();
+  
+  uv_queue_work(uv_default_loop(),
+    work_req, 
+    UV_FetchAll, 
+    (uv_after_work_cb)UV_AfterFetchAll);
+
+  data->objResult->Ref();
+
+  info.GetReturnValue().Set(Nan::Undefined());
+}
+
+/*
+ * ForEach
+ *
+ * Fetches the rest of the result set like FetchAll, but calls the row
+ * callback once per row as each batch of fetchSize rows comes back instead
+ * of collecting them, so only one batch is held at a time. The done
+ * callback gets the error, if any, and the number of rows.
+ */
+
+NAN_METHOD(ODBCResult::ForEach) {
+  DEBUG_PRINTF("ODBCResult::ForEach\n");
+  Nan::HandleScope scope;
+  
+  ODBCResult* objODBCResult = Nan::ObjectWrap::Unwrap<ODBCResult>(info.Holder());
+  
+  Local<Function> rowCb;
+  Local<Function> cb;
+  int fetchMode = objODBCResult->m_fetchMode;
+  int fetchSize = objODBCResult->m_fetchSize;
+  
+  if (info.Length() == 2 && info[0]->IsFunction() && info[1]->IsFunction()) {
+    rowCb = Local<Function>::Cast(info[0]);
+    cb = Local<Function>::Cast(info[1]);
+  }
+  else if (info.Length() == 3 && info[0]->IsObject() &&
+           info[1]->IsFunction() && info[2]->IsFunction()) {
+    rowCb = Local<Function>::Cast(info[1]);
+    cb = Local<Function>::Cast(info[2]);
+    
+    Local<Object> obj = info[0]->ToObject();
+    
+    Local<String> fetchModeKey = Nan::New<String>(OPTION_FETCH_MODE);
+    if (obj->Has(fetchModeKey) && obj->Get(fetchModeKey)->IsInt32()) {
+      fetchMode = obj->Get(fetchModeKey)->ToInt32()->Value();
+    }
+    
+    Local<String> fetchSizeKey = Nan::New<String>(OPTION_FETCH_SIZE);
+    if (obj->Has(fetchSizeKey) && obj->Get(fetchSizeKey)->IsInt32()) {
+      fetchSize = obj->Get(fetchSizeKey)->ToInt32()->Value();
+    }
+  }
+  else {
+    return Nan::ThrowTypeError("ODBCResult::ForEach(): 2 or 3 arguments are required. The last two arguments must be the row and done callback functions.");
+  }
+  
+  uv_work_t* work_req = (uv_work_t *) (calloc(1, sizeof(uv_work_t)));
+  MEMCHECK( work_req );
+  
+  fetch_work_data* data = (fetch_work_data *) calloc(1, sizeof(fetch_work_data));
+  MEMCHECK( data );
+  
+  //rows are handed out one at a time, so there are no columns to gather
+  data->fetchMode = fetchMode == FETCH_COLUMNAR ? FETCH_OBJECT : fetchMode;
+  data->fetchSize = fetchSize;
+  data->mode = MODE_CALLBACK_FOR_EACH;
+  data->errorCount = 0;
+  data->count = 0;
+  data->objError.Reset(Nan::New<Object>());
+  
+  data->cb = new Nan::Callback(cb);
+  data->rowCb = new Nan::Callback(rowCb);
+  data->objResult = objODBCResult;
+  
+  work_req->data = data;
+  
+  objODBCResult->ForgetLobs();
+  
   uv_queue_work(uv_default_loop(),
     work_req, 
     UV_FetchAll, 
@@ -464,7 +1213,13 @@ void ODBCResult::UV_FetchAll(uv_work_t* work_req) {
   
   fetch_work_data* data = (fetch_work_data *)(work_req->data);
   
-  data->result = SQLFetch(data->objResult->m_hSTMT);
+  ODBCResult* self = data->objResult->self();
+  
+  BindBuffers(self, data->fetchSize, data->fetchMode);
+  
+  //the whole buffer is filled here, so the loop thread only sees this
+  //request again once per fetchSize rows
+  data->result = FetchBuffers(self, data->fetchSize);
   DEBUG_PRINTF("ODBCResult::UV_FetchAll, return code = %d\n", data->result);
  }
 
@@ -477,14 +1232,58 @@ void ODBCResult::UV_AfterFetchAll(uv_work_t* work_req, int status) {
   ODBCResult* self = data->objResult->self();
   
   bool doMoreWork = true;
+  bool rowThrew = false;
   
-  if (self->colCount == 0) {
-    self->columns = ODBC::GetColumns(self->m_hSTMT, &self->colCount);
-    DEBUG_PRINTF("ODBCResult::UV_AfterFetchAll, colcount = %d, columns = %d\n", self->colCount, self->columns);
+  DEBUG_PRINTF("ODBCResult::UV_AfterFetchAll, colcount = %d, columns = %d\n", self->colCount, self->columns);
+  
+  //forEach gathers only this batch and hands it out row by row
+  Local<Array> rows;
+  int batchCount = 0;
+  
+  if (data->mode == MODE_CALLBACK_FOR_EACH) {
+    rows = Nan::New<Array>();
+  }
+  else {
+    rows = Nan::New(data->rows);
+  }
+  
+  //rows buffered before the end of the result set or an error still count
+  bool buffered = GetBufferedRows(self, data->fetchMode, rows,
+                                  data->mode == MODE_CALLBACK_FOR_EACH
+                                    ? &batchCount : &data->count,
+                                  &data->columnSet);
+  
+  if (data->mode == MODE_CALLBACK_FOR_EACH) {
+    Nan::TryCatch try_catch;
+    
+    for (int i = 0; i < batchCount; i++) {
+      Local<Value> info[2];
+      
+      info[0] = rows->Get(i);
+      info[1] = Nan::New(data->count++);
+      
+      data->rowCb->Call(2, info);
+      
+      if (try_catch.HasCaught()) {
+        FatalException(try_catch);
+        rowThrew = true;
+        break;
+      }
+    }
   }
   
+  if (rowThrew) {
+    doMoreWork = false;
+  }
+  else if (!buffered) {
+    data->errorCount++;
+    data->objError.Reset(Nan::Error("[node-odbc] Failed to allocate memory "
+      "for the columns in ODBCResult::UV_AfterFetchAll"));
+    
+    doMoreWork = false;
+  }
   //check to see if the result set has columns
-  if (self->colCount == 0) {
+  else if (self->colCount == 0) {
     //this most likely means that the query was something like
     //'insert into ....'
     doMoreWork = false;
@@ -493,11 +1292,17 @@ void ODBCResult::UV_AfterFetchAll(uv_work_t* work_req, int status) {
   else if (data->result == SQL_ERROR)  {
     data->errorCount++;
     
-    data->objError.Reset(ODBC::GetSQLError(
-      SQL_HANDLE_STMT, 
-      self->m_hSTMT,
-      (char *) "[node-odbc] Error in ODBCResult::UV_AfterFetchAll"
-    ));
+    if (self->rowData && self->rowData->outOfMemory) {
+      data->objError.Reset(Nan::Error("[node-odbc] Failed to allocate memory "
+        "buffer for column data in ODBCResult::UV_AfterFetchAll"));
+    }
+    else {
+      data->objError.Reset(ODBC::GetSQLError(
+        SQL_HANDLE_STMT, 
+        self->m_hSTMT,
+        (char *) "[node-odbc] Error in ODBCResult::UV_AfterFetchAll"
+      ));
+    }
     
     doMoreWork = false;
   }
@@ -505,33 +1310,6 @@ void ODBCResult::UV_AfterFetchAll(uv_work_t* work_req, int status) {
   else if (data->result == SQL_NO_DATA) {
     doMoreWork = false;
   }
-  else {
-    //TODO: !important: persistent forces us to set this to a local handle, but do we need to recopy it back to persistent handle?
-    Local<Array> rows = Nan::New(data->rows);
-    if (data->fetchMode == FETCH_ARRAY) {
-      rows->Set(
-        Nan::New(data->count), 
-        ODBC::GetRecordArray(
-          self->m_hSTMT,
-          self->columns,
-          &self->colCount,
-          self->buffer,
-          self->bufferLength)
-      );
-    }
-    else {
-      rows->Set(
-        Nan::New(data->count), 
-        ODBC::GetRecordTuple(
-          self->m_hSTMT,
-          self->columns,
-          &self->colCount,
-          self->buffer,
-          self->bufferLength)
-      );
-    }
-    data->count++;
-  }
   
   if (doMoreWork) {
     //Go back to the thread pool and fetch more data!
@@ -542,8 +1320,6 @@ void ODBCResult::UV_AfterFetchAll(uv_work_t* work_req, int status) {
       (uv_after_work_cb)UV_AfterFetchAll);
   }
   else {
-    ODBC::FreeColumns(self->columns, &self->colCount);
-    
     Local<Value> info[2];
     
     if (data->errorCount > 0) {
@@ -553,12 +1329,28 @@ void ODBCResult::UV_AfterFetchAll(uv_work_t* work_req, int status) {
       info[0] = Nan::Null();
     }
     
-    info[1] = Nan::New(data->rows);
+    if (data->columnSet) {
+      info[1] = ODBC::GetColumnSetArray(data->columnSet, self->columns);
+      ODBC::FreeColumnSet(data->columnSet);
+      data->columnSet = NULL;
+    }
+    else if (data->mode == MODE_CALLBACK_FOR_EACH) {
+      info[1] = Nan::New(data->count);
+    }
+    else {
+      info[1] = Nan::New(data->rows);
+    }
+    
+    self->FreeBuffers();
 
     Nan::TryCatch try_catch;
 
-    data->cb->Call(2, info);
+    //a row callback that threw has already been reported
+    if (!rowThrew) {
+      data->cb->Call(2, info);
+    }
     delete data->cb;
+    delete data->rowCb;
     data->rows.Reset();
     data->objError.Reset();
 
@@ -590,6 +1382,8 @@ NAN_METHOD(ODBCResult::FetchAllSync) {
   int count = 0;
   int errorCount = 0;
   int fetchMode = self->m_fetchMode;
+  int fetchSize = self->m_fetchSize;
+  ColumnSet *columnSet = NULL;
 
   if (info.Length() == 1 && info[0]->IsObject()) {
     Local<Object> obj = info[0]->ToObject();
@@ -598,79 +1392,346 @@ NAN_METHOD(ODBCResult::FetchAllSync) {
     if (obj->Has(fetchModeKey) && obj->Get(fetchModeKey)->IsInt32()) {
       fetchMode = obj->Get(fetchModeKey)->ToInt32()->Value();
     }
+    
+    Local<String> fetchSizeKey = Nan::New<String>(OPTION_FETCH_SIZE);
+    if (obj->Has(fetchSizeKey) && obj->Get(fetchSizeKey)->IsInt32()) {
+      fetchSize = obj->Get(fetchSizeKey)->ToInt32()->Value();
+    }
   }
   
-  if (self->colCount == 0) {
-    self->columns = ODBC::GetColumns(self->m_hSTMT, &self->colCount);
-  }
+  self->ForgetLobs();
+  BindBuffers(self, fetchSize, fetchMode);
   
   DEBUG_PRINTF("ODBCResult::FetchAllSync colCount = %i, fetchMode = %i\n", self->colCount, fetchMode);
 
   Local<Array> rows = Nan::New<Array>();
+  Local<Value> data;
   
-  //Only loop through the recordset if there are columns
-  if (self->colCount > 0) {
-    //loop through all records
-    while (true) {
-      ret = SQLFetch(self->m_hSTMT);
+  //loop through all records
+  while (true) {
+    ret = FetchBuffers(self, fetchSize);
+    
+    if (!GetBufferedRows(self, fetchMode, rows, &count, &columnSet)) {
+      errorCount++;
+      objError = Nan::Error("[node-odbc] Failed to allocate memory for the "
+                            "columns in ODBCResult::FetchAllSync");
+      break;
+    }
+    
+    //check to see if there was an error
+    if (ret == SQL_ERROR)  {
+      errorCount++;
       
-      //check to see if there was an error
-      if (ret == SQL_ERROR)  {
-        errorCount++;
-        
+      if (self->rowData && self->rowData->outOfMemory) {
+        objError = Nan::Error("[node-odbc] Failed to allocate memory buffer "
+                              "for column data in ODBCResult::FetchAllSync");
+      }
+      else {
         objError = ODBC::GetSQLError(
           SQL_HANDLE_STMT, 
           self->m_hSTMT,
           (char *) "[node-odbc] Error in ODBCResult::UV_AfterFetchAll; probably"
             " your query did not have a result set."
         );
-        
-        break;
       }
       
-      //check to see if we are at the end of the recordset
-      if (ret == SQL_NO_DATA) {
-        ODBC::FreeColumns(self->columns, &self->colCount);
-        
-        break;
-      }
+      break;
+    }
+    
+    //check to see if we are at the end of the recordset
+    if (ret == SQL_NO_DATA) {
+      break;
+    }
+  }
+  
+  if (columnSet) {
+    data = ODBC::GetColumnSetArray(columnSet, self->columns);
+    ODBC::FreeColumnSet(columnSet);
+  }
+  else {
+    data = rows;
+  }
+  
+  //the statement may be reused, so never leave it block bound
+  self->FreeBuffers();
+  
+  //throw the error object if there were errors
+  if (errorCount > 0) {
+    Nan::ThrowError(objError);
+  }
+  
+  info.GetReturnValue().Set(data);
+  DEBUG_PRINTF("ODBCResult::FetchAllSync() Done.\n");
+}
+
+/*
+ * BindBuffers
+ *
+ * Describes the result set and binds it for block fetch before the first
+ * fetch; when it can not be bound the rows are read with SQLGetData into a
+ * RowBuffer instead. Does not touch V8, so it may run on the thread pool.
+ */
+
+void ODBCResult::BindBuffers(ODBCResult* self, int fetchSize, int fetchMode) {
+  //rows left by fetch({ streamLobs : true }) are read in full from here on
+  if (self->rowData && self->rowData->deferred) {
+    ODBC::FreeRowBuffer(self->rowData);
+    self->rowData = NULL;
+  }
+  
+  if (self->block || self->rowData) {
+    return;
+  }
+  
+  if (self->colCount == 0) {
+    self->DescribeColumns();
+  }
+  
+  //FETCH_COLUMNAR fetches BIGINT columns as SQL_C_SBIGINT into
+  //BigInt64Arrays whatever the bigintMode; without BigInt they stay strings
+  //in a plain Array
+  ODBC::SetNumericTypes(self->columns, self->colCount,
+                        fetchMode == FETCH_COLUMNAR ? BIGINT_NATIVE
+                                                    : self->m_bigintMode,
+                        self->m_decimalMode);
+  ODBC::SetCharTypes(self->columns, self->colCount, self->m_charMode);
+  
+  self->block = ODBC::BindRowBlock(self->m_hSTMT, self->columns,
+                                   self->colCount, fetchSize);
+  
+  if (self->block == NULL && self->colCount > 0) {
+    self->rowData = ODBC::NewRowBuffer(self->columns, self->colCount, NULL);
+  }
+}
+
+/*
+ * FetchBuffers
+ *
+ * Fills the block or row buffer with up to fetchSize rows. Does not touch
+ * V8, so it may run on the thread pool.
+ */
+
+SQLRETURN ODBCResult::FetchBuffers(ODBCResult* self, int fetchSize) {
+  if (self->block) {
+    return ODBC::FetchRowBlock(self->m_hSTMT, self->block);
+  }
+  
+  if (self->rowData) {
+    return ODBC::FetchRowBuffer(self->m_hSTMT, self->columns,
+                                self->rowData, fetchSize);
+  }
+  
+  //no columns
+  return SQL_NO_DATA;
+}
 
+/*
+ * GetBufferedRows
+ *
+ * Appends the rows buffered by the last FetchBuffers to rows, or to the
+ * column set for FETCH_COLUMNAR. Returns false when the column set could
+ * not grow.
+ */
+
+bool ODBCResult::GetBufferedRows(ODBCResult* self, int fetchMode,
+                                 Local<Array> rows, int* count,
+                                 ColumnSet** columnSet) {
+  if (fetchMode == FETCH_COLUMNAR && (self->block || self->rowData)) {
+    if (*columnSet == NULL) {
+      *columnSet = ODBC::NewColumnSet(self->block, self->rowData);
+    }
+    
+    if (self->block) {
+      return ODBC::AppendBlockColumns(*columnSet, self->block);
+    }
+    return ODBC::AppendBufferedColumns(*columnSet, self->rowData);
+  }
+  
+  //row objects share the keys and template of the result set
+  RowShape *shape = NULL;
+  
+  if (fetchMode != FETCH_ARRAY && (self->block || self->rowData)) {
+    shape = self->GetShape();
+  }
+  
+  //lazyRows keep a copy of the block and decode cells as they are read;
+  //rows read with SQLGetData are decoded in full as before
+  if (self->block && self->m_lazyRows && fetchMode != FETCH_ARRAY &&
+      self->block->rowCount > 0) {
+    Local<Object> lazyBlock = ODBC::NewLazyBlock(self->block);
+    
+    if (lazyBlock.IsEmpty()) {
+      return false;
+    }
+    
+    for (SQLULEN i = 0; i < self->block->rowCount; i++) {
+      rows->Set(
+        Nan::New(*count), 
+        ODBC::GetLazyRecordTuple(lazyBlock, shape, i)
+      );
+      (*count)++;
+    }
+  }
+  else if (self->block) {
+    for (SQLULEN i = 0; i < self->block->rowCount; i++) {
       if (fetchMode == FETCH_ARRAY) {
         rows->Set(
-          Nan::New(count), 
-          ODBC::GetRecordArray(
-            self->m_hSTMT,
-            self->columns,
-            &self->colCount,
-            self->buffer,
-            self->bufferLength)
+          Nan::New(*count), 
+          ODBC::GetBlockRecordArray(self->block, self->columns, i)
         );
       }
       else {
         rows->Set(
-          Nan::New(count), 
-          ODBC::GetRecordTuple(
-            self->m_hSTMT,
-            self->columns,
-            &self->colCount,
-            self->buffer,
-            self->bufferLength)
+          Nan::New(*count), 
+          ODBC::GetBlockRecordTuple(self->block, shape, i)
         );
       }
-      count++;
+      (*count)++;
     }
   }
+  else if (self->rowData) {
+    size_t offset = 0;
+    
+    for (SQLULEN i = 0; i < self->rowData->rowCount; i++) {
+      if (fetchMode == FETCH_ARRAY) {
+        rows->Set(
+          Nan::New(*count), 
+          ODBC::GetBufferedRecordArray(self->rowData, self->columns, &offset)
+        );
+      }
+      else {
+        rows->Set(
+          Nan::New(*count), 
+          ODBC::GetBufferedRecordTuple(self->rowData, shape, &offset)
+        );
+      }
+      (*count)++;
+    }
+  }
+  
+  return true;
+}
+
+/*
+ * FreeBuffers
+ *
+ * Frees what BindBuffers set up and the column descriptions, leaving the
+ * statement ready for the next result set or execution.
+ */
+
+void ODBCResult::FreeBuffers() {
+  ForgetLobs();
+  ODBC::FreeRowBlock(m_hSTMT, block);
+  block = NULL;
+  ODBC::FreeRowBuffer(rowData);
+  rowData = NULL;
+  
+  //what the statement's cache holds stays there for the next execution
+  bool cached = columns && shapeCache && columns == shapeCache->columns;
+  
+  if (cached) {
+    colCount = 0;
+  }
   else {
-    ODBC::FreeColumns(self->columns, &self->colCount);
+    ODBC::FreeColumns(columns, &colCount);
+    ODBC::FreeRowShape(shape);
+  }
+  columns = NULL;
+  shape = NULL;
+  
+  //only the first result set of an execution is the one cached; a later
+  //one from moreResults describes its own columns
+  if (cached) {
+    ODBC::ReleaseShapeCache(shapeCache);
+    shapeCache = NULL;
+  }
+}
+
+/*
+ * ForgetLobs
+ *
+ * Called on the loop thread before the cursor moves. The LOB streams of the
+ * row it was on can not be read any more, and the next row starts with no
+ * LOB half read.
+ */
+
+void ODBCResult::ForgetLobs() {
+  rowGeneration++;
+  lobColumn = -1;
+  lobCarry = 0;
+}
+
+/*
+ * DescribeColumns
+ *
+ * Describes the columns of the current result set, or borrows them from the
+ * prepared statement when an earlier execution already did. Does not touch
+ * V8, so it may run on the thread pool.
+ */
+
+void ODBCResult::DescribeColumns() {
+  if (shapeCache && shapeCache->columns) {
+    columns = shapeCache->columns;
+    colCount = shapeCache->colCount;
+    return;
   }
   
-  //throw the error object if there were errors
-  if (errorCount > 0) {
-    Nan::ThrowError(objError);
+  columns = ODBC::GetColumns(m_hSTMT, &colCount);
+  
+  if (shapeCache && columns) {
+    shapeCache->columns = columns;
+    shapeCache->colCount = colCount;
+  }
+}
+
+/*
+ * GetShape
+ *
+ * The row shape of the current result set, created on first use or taken
+ * from the prepared statement's cache.
+ */
+
+RowShape* ODBCResult::GetShape() {
+  if (shape == NULL) {
+    bool cached = columns && shapeCache && columns == shapeCache->columns;
+    
+    if (cached && shapeCache->shape) {
+      shape = shapeCache->shape;
+    }
+    else {
+      shape = ODBC::NewRowShape(columns, colCount);
+      
+      if (cached) {
+        shapeCache->shape = shape;
+      }
+    }
   }
   
-  info.GetReturnValue().Set(rows);
-  DEBUG_PRINTF("ODBCResult::FetchAllSync() Done.\n");
+  return shape;
+}
+
+/*
+ * ReserveBuffer
+ *
+ * Grows the GetColumnValue buffer to fit the widest non-LOB column of the
+ * current result set, so that FetchSync reads each of those values with a
+ * single SQLGetData.
+ */
+
+void ODBCResult::ReserveBuffer() {
+  int length = ODBC::GetColumnBufferLength(columns, colCount);
+  
+  if (length <= bufferLength) {
+    return;
+  }
+  
+  uint16_t *grown = (uint16_t *) realloc(buffer, length + 2);
+  
+  //keep the old buffer, GetColumnValue still copes with long values
+  if (grown) {
+    buffer = grown;
+    bufferLength = length;
+  }
 }
 
 /*
@@ -689,17 +1750,22 @@ NAN_METHOD(ODBCResult::CloseSync) {
   DEBUG_PRINTF("ODBCResult::CloseSync closeOption=%i m_canFreeHandle=%i, hSTMT=%X\n", 
                closeOption, result->m_canFreeHandle,result->m_hSTMT);
   
-  if (closeOption == SQL_DESTROY && result->m_canFreeHandle) {
+  if (closeOption == SQL_DESTROY &&
+      (result->m_canFreeHandle || result->cachedStatement)) {
     result->Free();
   }
   else if (closeOption == SQL_DESTROY && !result->m_canFreeHandle) {
-    //We technically can't free the handle so, we'll SQL_CLOSE
+    //the handle is the statement's, which hands it to the connection's pool
+    //when it is closed, so the result only closes the cursor and never
+    //frees the handle. A block fetchN left bound is unbound first, so that
+    //the next execution does not inherit it.
+    result->FreeBuffers();
     SQLFreeStmt(result->m_hSTMT, SQL_CLOSE);
-    result->m_canFreeHandle = new bool(true);
+    result->m_closed = true;
   }
   else {
+    result->FreeBuffers();
     SQLFreeStmt(result->m_hSTMT, closeOption);
-    result->m_canFreeHandle = new bool(true);
   }
   
   info.GetReturnValue().Set(Nan::True());
@@ -712,6 +1778,13 @@ NAN_METHOD(ODBCResult::MoreResultsSync) {
   
   ODBCResult* result = Nan::ObjectWrap::Unwrap<ODBCResult>(info.Holder());
   
+  //the columns and shape of this result set are no good for the next one,
+  //and only the first result set is the prepared statement's to cache, so
+  //the next one describes its own columns even if this one was never read
+  result->FreeBuffers();
+  ODBC::ReleaseShapeCache(result->shapeCache);
+  result->shapeCache = NULL;
+  
   SQLRETURN ret = SQLMoreResults(result->m_hSTMT);
 
   if (ret == SQL_ERROR) {
@@ -734,7 +1807,7 @@ NAN_METHOD(ODBCResult::GetColumnNamesSync) {
   Local<Array> cols = Nan::New<Array>();
   
   if (self->colCount == 0) {
-    self->columns = ODBC::GetColumns(self->m_hSTMT, &self->colCount);
+    self->DescribeColumns();
   }
   
   for (int i = 0; i < self->colCount; i++) {
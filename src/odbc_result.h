@@ -22,6 +22,8 @@
 class ODBCResult : public Nan::ObjectWrap {
   public:
    static Nan::Persistent<String> OPTION_FETCH_MODE;
+   static Nan::Persistent<String> OPTION_FETCH_SIZE;
+   static Nan::Persistent<String> OPTION_STREAM_LOBS;
    static Nan::Persistent<Function> constructor;
    static void Init(v8::Handle<Object> exports);
    
@@ -50,6 +52,16 @@ class ODBCResult : public Nan::ObjectWrap {
     static NAN_METHOD(FetchAll);
     static void UV_FetchAll(uv_work_t* work_req);
     static void UV_AfterFetchAll(uv_work_t* work_req, int status);
+
+    static NAN_METHOD(ForEach);
+
+    static NAN_METHOD(FetchN);
+    static void UV_FetchN(uv_work_t* work_req);
+    static void UV_AfterFetchN(uv_work_t* work_req, int status);
+
+    static NAN_METHOD(GetData);
+    static void UV_GetData(uv_work_t* work_req);
+    static void UV_AfterGetData(uv_work_t* work_req, int status);
     
     //sync methods
     static NAN_METHOD(CloseSync);
@@ -61,17 +73,61 @@ class ODBCResult : public Nan::ObjectWrap {
     //property getter/setters
     static NAN_GETTER(FetchModeGetter);
     static NAN_SETTER(FetchModeSetter);
+    static NAN_GETTER(FetchSizeGetter);
+    static NAN_SETTER(FetchSizeSetter);
+    static NAN_GETTER(BigintModeGetter);
+    static NAN_SETTER(BigintModeSetter);
+    static NAN_GETTER(DecimalModeGetter);
+    static NAN_SETTER(DecimalModeSetter);
+    static NAN_GETTER(CharModeGetter);
+    static NAN_SETTER(CharModeSetter);
+    static NAN_GETTER(LazyRowsGetter);
+    static NAN_SETTER(LazyRowsSetter);
+    static NAN_GETTER(RowGenerationGetter);
+    
+    //fetchAll helpers shared by the async and sync versions
+    static void BindBuffers(ODBCResult* self, int fetchSize, int fetchMode);
+    static SQLRETURN FetchBuffers(ODBCResult* self, int fetchSize);
+    static bool GetBufferedRows(ODBCResult* self, int fetchMode, Local<Array> rows,
+                                int* count, ColumnSet** columnSet);
+    void DescribeColumns();
+    void FreeBuffers();
+    void ForgetLobs();
+    RowShape* GetShape();
+    void ReserveBuffer();
     
     struct fetch_work_data {
       Nan::Callback* cb;
       ODBCResult *objResult;
       SQLRETURN result;
       
+      int mode;              // MODE_COLLECT_AND_CALLBACK or MODE_CALLBACK_FOR_EACH
+      Nan::Callback* rowCb;  // called per row in MODE_CALLBACK_FOR_EACH
       int fetchMode;
+      int fetchSize;
+      bool streamLobs;
+      int *lobColumns;       // columns streamLobs picked, NULL for every LOB
+      int lobColumnCount;
       int count;
       int errorCount;
       Nan::Persistent<Array> rows;
       Nan::Persistent<Value> objError;
+      ColumnSet *columnSet;
+    };
+    
+    struct getdata_work_data {
+      Nan::Callback* cb;
+      ODBCResult *objResult;
+      SQLRETURN result;
+      
+      short column;
+      unsigned int generation;  // rowGeneration of the row it reads from
+      SQLSMALLINT c_type;
+      char *buffer;
+      SQLLEN bufferLength;
+      SQLLEN offset;  // bytes of buffer taken by a carried over code unit
+      SQLLEN len;     // bytes of data in buffer
+      bool more;      // the value did not fit
     };
     
     ODBCResult *self(void) { return this; }
@@ -81,12 +137,36 @@ class ODBCResult : public Nan::ObjectWrap {
     SQLHDBC m_hDBC;
     SQLHSTMT m_hSTMT;
     bool m_canFreeHandle;
+    bool m_closed;          // CloseSync closed a handle it does not own
     int m_fetchMode;
+    int m_fetchSize;
+    int m_bigintMode;
+    int m_decimalMode;
+    int m_charMode;
+    bool m_lazyRows;
     
     uint16_t *buffer;
     int bufferLength;
     Column *columns;
     short colCount;
+    RowBlock *block;
+    RowBuffer *rowData;
+    RowShape *shape;
+    ShapeCache *shapeCache;  // the prepared statement's, NULL otherwise
+    CachedStatement *cachedStatement;  // handed back instead of freed
+    StatementPool *statementPool;      // where m_hSTMT goes when freed
+    
+    //the LOB column being read, -1 between values, and a high surrogate at
+    //the end of a character LOB chunk held back until the chunk that ends
+    //the pair. rowGeneration counts the moves of the cursor, so that the
+    //stream of a LOB fails once its row is gone.
+    short lobColumn;
+    uint16_t lobCarry;
+    unsigned int rowGeneration;
+    
+    //SQL_GETDATA_EXTENSIONS of the driver, asked for by the first GetData
+    SQLUINTEGER getDataExtensions;
+    bool getDataChecked;
 };
 
 
@@ -55,12 +55,17 @@ void ODBCStatement::Init(v8::Handle<Object> exports) {
   Nan::SetPrototypeMethod(t, "executeNonQuery", ExecuteNonQuery);
   Nan::SetPrototypeMethod(t, "executeNonQuerySync", ExecuteNonQuerySync);
   
+  Nan::SetPrototypeMethod(t, "executeBatch", ExecuteBatch);
+  Nan::SetPrototypeMethod(t, "executeBatchSync", ExecuteBatchSync);
+  
   Nan::SetPrototypeMethod(t, "prepare", Prepare);
   Nan::SetPrototypeMethod(t, "prepareSync", PrepareSync);
   
   Nan::SetPrototypeMethod(t, "bind", Bind);
   Nan::SetPrototypeMethod(t, "bindSync", BindSync);
   
+  Nan::SetPrototypeMethod(t, "putData", PutData);
+  
   Nan::SetPrototypeMethod(t, "closeSync", CloseSync);
 
   // Attach the Database Constructor to the target object
@@ -75,15 +80,17 @@ ODBCStatement::~ODBCStatement() {
 void ODBCStatement::Free() {
   DEBUG_PRINTF("ODBCStatement::Free paramCount = %i, m_hSTMT =%X\n", paramCount, m_hSTMT);
   //if we previously had parameters, then be sure to free them
-  if (paramCount) {
-      FREE_PARAMS( params, paramCount ) ;
-      DEBUG_PRINTF("ODBCStatement::Free - Params Freed.\n");
-  }
+  FREE_PARAMS( params, paramCount ) ;
+  DEBUG_PRINTF("ODBCStatement::Free - Params Freed.\n");
+  ODBC::FreeParameterDescriptors(&paramDescriptors);
   
   if (m_hSTMT) {
-    SQLFreeHandle(SQL_HANDLE_STMT, m_hSTMT);
+    ODBC::ReleasePooledStatement(statementPool, m_hSTMT);
+    statementPool = NULL;
     m_hSTMT = (SQLHSTMT)NULL;
   }
+  
+  ResetShapeCache();
     
   if (bufferLength > 0) {
       if(buffer) free(buffer);
@@ -108,6 +115,14 @@ NAN_METHOD(ODBCStatement::New) {
   //create a new OBCResult object
   ODBCStatement* stmt = new ODBCStatement(hENV, hDBC, hSTMT);
   
+  //the handle may come from the connection's pool and goes back there
+  stmt->statementPool = NULL;
+  
+  if (info.Length() > 3 && info[3]->IsExternal()) {
+    stmt->statementPool = static_cast<StatementPool *>(
+      Local<External>::Cast(info[3])->Value());
+  }
+  
   //specify the buffer length
   stmt->bufferLength = MAX_VALUE_SIZE;
   
@@ -115,18 +130,66 @@ NAN_METHOD(ODBCStatement::New) {
   stmt->buffer = (uint16_t *) malloc(stmt->bufferLength+2);
   MEMCHECK( stmt->buffer );
 
-  //set the initial colCount to 0
-  stmt->colCount = 0;
+  //nothing is prepared yet
+  stmt->shapeCache = NULL;
+  stmt->paramDataReq = NULL;
   
   //initialize the paramCount
   stmt->paramCount = 0;
   stmt->params = 0;
+  stmt->paramDescriptors.descriptors = NULL;
+  stmt->paramDescriptors.capacity = 0;
   
   stmt->Wrap(info.Holder());
   
   info.GetReturnValue().Set(info.Holder());
 }
 
+/*
+ * ResetShapeCache
+ *
+ * Forgets the column descriptions of the SQL prepared so far, when other SQL
+ * is prepared or executed on the statement. Results still holding the cache
+ * keep it alive until they are done with it.
+ */
+
+void ODBCStatement::ResetShapeCache() {
+  ODBC::ReleaseShapeCache(shapeCache);
+  shapeCache = NULL;
+}
+
+/*
+ * NewResult
+ *
+ * Wraps the statement handle in an ODBCResult after an execution of the
+ * prepared SQL. Every such result shares the statement's ShapeCache, so only
+ * the first one describes the columns and builds the row shape.
+ */
+
+Local<Object> ODBCStatement::NewResult() {
+  Nan::EscapableHandleScope scope;
+  
+  Local<Value> info[5];
+  bool* canFreeHandle = new bool(false);
+  int argc = 4;
+  
+  if (shapeCache == NULL) {
+    shapeCache = ODBC::NewShapeCache();
+  }
+  
+  info[0] = Nan::New<External>((void*) (intptr_t) m_hENV);
+  info[1] = Nan::New<External>((void*) (intptr_t) m_hDBC);
+  info[2] = Nan::New<External>((void*) (intptr_t) m_hSTMT);
+  info[3] = Nan::New<External>((void*)canFreeHandle);
+  
+  if (shapeCache) {
+    info[argc++] = Nan::New<External>((void*)shapeCache);
+  }
+  
+  return scope.Escape(
+    Nan::New<Function>(ODBCResult::constructor)->NewInstance(argc, info));
+}
+
 /*
  * Execute
  */
@@ -149,7 +212,12 @@ NAN_METHOD(ODBCStatement::Execute) {
 
   data->cb = new Nan::Callback(cb);
   
+  if (info.Length() > 1 && info[1]->IsFunction()) {
+    data->pull = new Nan::Callback(Local<Function>::Cast(info[1]));
+  }
+  
   data->stmt = stmt;
+  data->after = (uv_after_work_cb)UV_AfterExecute;
   work_req->data = data;
   
   uv_queue_work(
@@ -171,6 +239,10 @@ void ODBCStatement::UV_Execute(uv_work_t* req) {
   SQLRETURN ret;
   
   ret = SQLExecute(data->stmt->m_hSTMT); 
+  
+  if (ret == SQL_NEED_DATA) {
+    ret = SQLParamData(data->stmt->m_hSTMT, &data->token);
+  }
 
   data->result = ret;
 }
@@ -185,6 +257,10 @@ void ODBCStatement::UV_AfterExecute(uv_work_t* req, int status) {
   
   //an easy reference to the statment object
   ODBCStatement* stmt = data->stmt->self();
+  
+  if (data->result == SQL_NEED_DATA) {
+    return stmt->NeedParamData(req);
+  }
 
   if (SQL_SUCCEEDED( data->result )) {
     for(int i = 0; i < stmt->paramCount; i++) { // For stored Procedure CALL
@@ -194,10 +270,6 @@ void ODBCStatement::UV_AfterExecute(uv_work_t* req, int status) {
       }
     }
   }
-  if( stmt->paramCount ) {
-    FREE_PARAMS( stmt->params, stmt->paramCount ) ;
-  }
-  
   //First thing, let's check if the execution of the query returned any errors 
   if(data->result == SQL_ERROR) {
     ODBC::CallbackSQLError(
@@ -206,15 +278,8 @@ void ODBCStatement::UV_AfterExecute(uv_work_t* req, int status) {
       data->cb);
   }
   else {
-    Local<Value> info[4];
-    bool* canFreeHandle = new bool(false);
-    
-    info[0] = Nan::New<External>((void*) (intptr_t) stmt->m_hENV);
-    info[1] = Nan::New<External>((void*) (intptr_t) stmt->m_hDBC);
-    info[2] = Nan::New<External>((void*) (intptr_t) stmt->m_hSTMT);
-    info[3] = Nan::New<External>((void*)canFreeHandle);
-    
-    Local<Object> js_result = Nan::New<Function>(ODBCResult::constructor)->NewInstance(4, info);
+    Local<Value> info[3];
+    Local<Object> js_result = stmt->NewResult();
 
     info[0] = Nan::Null();
     info[1] = js_result;
@@ -235,6 +300,7 @@ void ODBCStatement::UV_AfterExecute(uv_work_t* req, int status) {
 
   stmt->Unref();
   delete data->cb;
+  delete data->pull;
   
   free(data);
   free(req);
@@ -255,6 +321,12 @@ NAN_METHOD(ODBCStatement::ExecuteSync) {
   Local<Array> sp_result = Nan::New<Array>();
 
   SQLRETURN ret = SQLExecute(stmt->m_hSTMT); 
+  
+  if (ret == SQL_NEED_DATA) {
+    SQLCancel(stmt->m_hSTMT);
+    return Nan::ThrowError("[node-odbc] Stream parameters can only be sent "
+                           "by ODBCStatement::Execute or ExecuteNonQuery");
+  }
 
   if (SQL_SUCCEEDED(ret)) {
     for(int i = 0; i < stmt->paramCount; i++) { // For stored Procedure CALL
@@ -264,10 +336,6 @@ NAN_METHOD(ODBCStatement::ExecuteSync) {
       }
     }
   }
-  if( stmt->paramCount ) {
-    FREE_PARAMS( stmt->params, stmt->paramCount ) ;
-  }
-  
   if(ret == SQL_ERROR) {
     Nan::ThrowError(ODBC::GetSQLError(
       SQL_HANDLE_STMT,
@@ -278,15 +346,7 @@ NAN_METHOD(ODBCStatement::ExecuteSync) {
     info.GetReturnValue().Set(Nan::Null());
   }
   else {
-    Local<Value> result[4];
-    bool* canFreeHandle = new bool(false);
-    
-    result[0] = Nan::New<External>((void*) (intptr_t) stmt->m_hENV);
-    result[1] = Nan::New<External>((void*) (intptr_t) stmt->m_hDBC);
-    result[2] = Nan::New<External>((void*) (intptr_t) stmt->m_hSTMT);
-    result[3] = Nan::New<External>((void*)canFreeHandle);
-    
-    Local<Object> js_result = Nan::New(ODBCResult::constructor)->NewInstance(4, result);
+    Local<Object> js_result = stmt->NewResult();
 
     if( outParamCount ) // Its a CALL stmt with OUT params.
     {   // Return an array with outparams as second element. [result, outparams]
@@ -322,7 +382,12 @@ NAN_METHOD(ODBCStatement::ExecuteNonQuery) {
 
   data->cb = new Nan::Callback(cb);
   
+  if (info.Length() > 1 && info[1]->IsFunction()) {
+    data->pull = new Nan::Callback(Local<Function>::Cast(info[1]));
+  }
+  
   data->stmt = stmt;
+  data->after = (uv_after_work_cb)UV_AfterExecuteNonQuery;
   work_req->data = data;
   
   uv_queue_work(
@@ -344,6 +409,10 @@ void ODBCStatement::UV_ExecuteNonQuery(uv_work_t* req) {
   SQLRETURN ret;
   
   ret = SQLExecute(data->stmt->m_hSTMT); 
+  
+  if (ret == SQL_NEED_DATA) {
+    ret = SQLParamData(data->stmt->m_hSTMT, &data->token);
+  }
 
   data->result = ret;
 }
@@ -357,6 +426,10 @@ void ODBCStatement::UV_AfterExecuteNonQuery(uv_work_t* req, int status) {
   
   //an easy reference to the statment object
   ODBCStatement* self = data->stmt->self();
+  
+  if (data->result == SQL_NEED_DATA) {
+    return self->NeedParamData(req);
+  }
 
   //First thing, let's check if the execution of the query returned any errors 
   if(data->result == SQL_ERROR) {
@@ -392,6 +465,7 @@ void ODBCStatement::UV_AfterExecuteNonQuery(uv_work_t* req, int status) {
 
   self->Unref();
   delete data->cb;
+  delete data->pull;
   
   free(data);
   free(req);
@@ -411,6 +485,12 @@ NAN_METHOD(ODBCStatement::ExecuteNonQuerySync) {
 
   SQLRETURN ret = SQLExecute(stmt->m_hSTMT); 
   
+  if (ret == SQL_NEED_DATA) {
+    SQLCancel(stmt->m_hSTMT);
+    return Nan::ThrowError("[node-odbc] Stream parameters can only be sent "
+                           "by ODBCStatement::Execute or ExecuteNonQuery");
+  }
+  
   if(ret == SQL_ERROR) {
     Nan::ThrowError(ODBC::GetSQLError(
       SQL_HANDLE_STMT,
@@ -435,6 +515,170 @@ NAN_METHOD(ODBCStatement::ExecuteNonQuerySync) {
   }
 }
 
+/*
+ * ExecuteBatch
+ *
+ * Executes the prepared statement once for many rows of parameters, bound
+ * as arrays through SQL_ATTR_PARAMSET_SIZE, and calls back with the row
+ * count and a status per row. Takes an Array of rows, or an Array of
+ * columns when the second argument is true.
+ */
+
+NAN_METHOD(ODBCStatement::ExecuteBatch) {
+  DEBUG_PRINTF("ODBCStatement::ExecuteBatch\n");
+  
+  Nan::HandleScope scope;
+
+  if (info.Length() < 1 || !info[0]->IsArray()) {
+    return Nan::ThrowTypeError("Argument 0 must be an Array");
+  }
+  REQ_BOOL_ARG(1, columnar);
+  REQ_FUN_ARG(2, cb);
+
+  ODBCStatement* stmt = Nan::ObjectWrap::Unwrap<ODBCStatement>(info.Holder());
+  
+  ParameterBatch* batch = ODBC::GetParameterBatch(
+    Local<Array>::Cast(info[0]), columnar->Value());
+  
+  if (batch == NULL) {
+    return;
+  }
+  
+  //the batch binds every parameter itself and unbinds them after, so the
+  //ones bound last time can go
+  FREE_PARAMS( stmt->params, stmt->paramCount ) ;
+  
+  uv_work_t* work_req = (uv_work_t *) (calloc(1, sizeof(uv_work_t)));
+  MEMCHECK( work_req );
+  
+  execute_batch_work_data* data = 
+    (execute_batch_work_data *) calloc(1, sizeof(execute_batch_work_data));
+  MEMCHECK( data );
+
+  data->cb = new Nan::Callback(cb);
+  data->batch = batch;
+  
+  data->stmt = stmt;
+  work_req->data = data;
+  
+  uv_queue_work(
+    uv_default_loop(),
+    work_req,
+    UV_ExecuteBatch,
+    (uv_after_work_cb)UV_AfterExecuteBatch);
+
+  stmt->Ref();
+  
+  info.GetReturnValue().Set(Nan::Undefined());
+}
+
+void ODBCStatement::UV_ExecuteBatch(uv_work_t* req) {
+  DEBUG_PRINTF("ODBCStatement::UV_ExecuteBatch\n");
+  
+  execute_batch_work_data* data = (execute_batch_work_data *)(req->data);
+
+  data->result = ODBC::ExecuteParameterBatch(data->stmt->m_hSTMT, data->batch);
+}
+
+void ODBCStatement::UV_AfterExecuteBatch(uv_work_t* req, int status) {
+  DEBUG_PRINTF("ODBCStatement::UV_AfterExecuteBatch\n");
+  
+  execute_batch_work_data* data = (execute_batch_work_data *)(req->data);
+  
+  Nan::HandleScope scope;
+  
+  ODBCStatement* self = data->stmt->self();
+  
+  Local<Value> info[2];
+  
+  //read the error before the reset clears it; the status of each row is
+  //passed along either way
+  if (data->result == SQL_ERROR) {
+    info[0] = ODBC::GetSQLError(
+      SQL_HANDLE_STMT,
+      self->m_hSTMT,
+      (char *) "[node-odbc] Error in ODBCStatement::ExecuteBatch");
+  }
+  else {
+    info[0] = Nan::Null();
+  }
+  
+  ODBC::ResetParameterBatch(self->m_hSTMT);
+  
+  info[1] = ODBC::GetParameterBatchResult(data->batch);
+  ODBC::FreeParameterBatch(data->batch);
+
+  Nan::TryCatch try_catch;
+  
+  data->cb->Call(Nan::GetCurrentContext()->Global(), 2, info);
+
+  if (try_catch.HasCaught()) {
+    FatalException(try_catch);
+  }
+
+  self->Unref();
+  delete data->cb;
+  
+  free(data);
+  free(req);
+}
+
+/*
+ * ExecuteBatchSync
+ * 
+ */
+
+NAN_METHOD(ODBCStatement::ExecuteBatchSync) {
+  DEBUG_PRINTF("ODBCStatement::ExecuteBatchSync\n");
+  
+  Nan::HandleScope scope;
+
+  if (info.Length() < 1 || !info[0]->IsArray()) {
+    return Nan::ThrowTypeError("Argument 0 must be an Array");
+  }
+  REQ_BOOL_ARG(1, columnar);
+
+  ODBCStatement* stmt = Nan::ObjectWrap::Unwrap<ODBCStatement>(info.Holder());
+
+  ParameterBatch* batch = ODBC::GetParameterBatch(
+    Local<Array>::Cast(info[0]), columnar->Value());
+  
+  if (batch == NULL) {
+    return;
+  }
+  
+  //the batch binds every parameter itself and unbinds them after, so the
+  //ones bound last time can go
+  FREE_PARAMS( stmt->params, stmt->paramCount ) ;
+  
+  SQLRETURN ret = ODBC::ExecuteParameterBatch(stmt->m_hSTMT, batch);
+  
+  if (ret == SQL_ERROR) {
+    Local<Value> err = ODBC::GetSQLError(
+      SQL_HANDLE_STMT,
+      stmt->m_hSTMT,
+      (char *) "[node-odbc] Error in ODBCStatement::ExecuteBatchSync"
+    );
+    
+    ODBC::ResetParameterBatch(stmt->m_hSTMT);
+    
+    //the status of each row goes along with the error
+    if (err->IsObject()) {
+      err->ToObject()->Set(Nan::New("result").ToLocalChecked(),
+                           ODBC::GetParameterBatchResult(batch));
+    }
+    ODBC::FreeParameterBatch(batch);
+    
+    Nan::ThrowError(err);
+    return;
+  }
+  
+  ODBC::ResetParameterBatch(stmt->m_hSTMT);
+  
+  info.GetReturnValue().Set(ODBC::GetParameterBatchResult(batch));
+  ODBC::FreeParameterBatch(batch);
+}
+
 /*
  * ExecuteDirect
  * 
@@ -449,6 +693,7 @@ NAN_METHOD(ODBCStatement::ExecuteDirect) {
   REQ_FUN_ARG(1, cb);
 
   ODBCStatement* stmt = Nan::ObjectWrap::Unwrap<ODBCStatement>(info.Holder());
+  stmt->ResetShapeCache();
   
   uv_work_t* work_req = (uv_work_t *) (calloc(1, sizeof(uv_work_t)));
   MEMCHECK( work_req );
@@ -567,6 +812,7 @@ NAN_METHOD(ODBCStatement::ExecuteDirectSync) {
 #endif
 
   ODBCStatement* stmt = Nan::ObjectWrap::Unwrap<ODBCStatement>(info.Holder());
+  stmt->ResetShapeCache();
   
   SQLRETURN ret = SQLExecDirect(
     stmt->m_hSTMT,
@@ -613,6 +859,7 @@ NAN_METHOD(ODBCStatement::PrepareSync) {
   REQ_STRO_ARG(0, sql);
 
   ODBCStatement* stmt = Nan::ObjectWrap::Unwrap<ODBCStatement>(info.Holder());
+  stmt->ResetShapeCache();
 
   SQLRETURN ret;
 
@@ -663,6 +910,7 @@ NAN_METHOD(ODBCStatement::Prepare) {
   REQ_FUN_ARG(1, cb);
 
   ODBCStatement* stmt = Nan::ObjectWrap::Unwrap<ODBCStatement>(info.Holder());
+  stmt->ResetShapeCache();
   
   uv_work_t* work_req = (uv_work_t *) (calloc(1, sizeof(uv_work_t)));
   MEMCHECK( work_req );
@@ -785,19 +1033,28 @@ NAN_METHOD(ODBCStatement::BindSync)
     stmt->m_hSTMT
   );
   
-  //if we previously had parameters, then be sure to free them
-  //before allocating more
-  if (stmt->paramCount) {
-      FREE_PARAMS( stmt->params, stmt->paramCount ) ;
-  }
-  
-  stmt->params = ODBC::GetParametersFromArray(
-    Local<Array>::Cast(info[0]), 
-    &stmt->paramCount);
-  
   SQLRETURN ret = SQL_SUCCESS;
 
-  ret = ODBC::BindParameters( stmt->m_hSTMT, stmt->params, stmt->paramCount ) ;
+  //values like the last ones go in their buffers, which are still bound
+  if (!ODBC::ReuseParameters(Local<Array>::Cast(info[0]),
+                             stmt->params, stmt->paramCount)) {
+    //if we previously had parameters, then be sure to free them
+    //before allocating more
+    FREE_PARAMS( stmt->params, stmt->paramCount ) ;
+    
+    stmt->params = ODBC::GetParametersFromArray(
+      Local<Array>::Cast(info[0]), 
+      &stmt->paramCount,
+      NULL,
+      &stmt->paramDescriptors);
+    
+    //a malformed parameter has thrown already
+    if (!stmt->params) {
+      return;
+    }
+    
+    ret = ODBC::BindParameters( stmt->m_hSTMT, stmt->params, stmt->paramCount ) ;
+  }
 
   if (SQL_SUCCEEDED(ret)) {
     info.GetReturnValue().Set(Nan::True());
@@ -809,6 +1066,9 @@ NAN_METHOD(ODBCStatement::BindSync)
       (char *) "[node-odbc] Error in ODBCStatement::BindSync"
     ));
     
+    //half bound parameters are no good for ReuseParameters
+    FREE_PARAMS( stmt->params, stmt->paramCount ) ;
+    
     info.GetReturnValue().Set(Nan::False());
   }
 
@@ -840,14 +1100,18 @@ NAN_METHOD(ODBCStatement::Bind) {
     (bind_work_data *) calloc(1, sizeof(bind_work_data));
   MEMCHECK( data );
 
+  data->stmt = stmt;
+  
+  //values like the last ones go in their buffers, which are still bound
+  data->reused = ODBC::ReuseParameters(Local<Array>::Cast(info[0]),
+                                       stmt->params, stmt->paramCount);
+  
   //if we previously had parameters, then be sure to free them
   //before allocating more
-  if (stmt->paramCount) {
+  if (!data->reused) {
       FREE_PARAMS( stmt->params, stmt->paramCount ) ;
   }
   
-  data->stmt = stmt;
-  
   DEBUG_PRINTF("ODBCStatement::Bind m_hDBC=%X m_hDBC=%X m_hSTMT=%X\n",
     data->stmt->m_hENV,
     data->stmt->m_hDBC,
@@ -856,9 +1120,21 @@ NAN_METHOD(ODBCStatement::Bind) {
   
   data->cb = new Nan::Callback(cb);
   
-  data->stmt->params = ODBC::GetParametersFromArray(
-    Local<Array>::Cast(info[0]), 
-    &data->stmt->paramCount);
+  if (!data->reused) {
+    data->stmt->params = ODBC::GetParametersFromArray(
+      Local<Array>::Cast(info[0]), 
+      &data->stmt->paramCount,
+      NULL,
+      &stmt->paramDescriptors);
+    
+    //a malformed parameter has thrown already
+    if (!data->stmt->params) {
+      delete data->cb;
+      free(data);
+      free(work_req);
+      return;
+    }
+  }
   
   work_req->data = data;
   
@@ -884,8 +1160,13 @@ void ODBCStatement::UV_Bind(uv_work_t* req) {
     data->stmt->m_hSTMT
   );
   
-  data->result = ODBC::BindParameters( data->stmt->m_hSTMT, 
-                 data->stmt->params, data->stmt->paramCount ) ;
+  if (data->reused) {
+    data->result = SQL_SUCCESS;
+  }
+  else {
+    data->result = ODBC::BindParameters( data->stmt->m_hSTMT, 
+                   data->stmt->params, data->stmt->paramCount ) ;
+  }
 }
 
 void ODBCStatement::UV_AfterBind(uv_work_t* req, int status) {
@@ -900,6 +1181,9 @@ void ODBCStatement::UV_AfterBind(uv_work_t* req, int status) {
 
   //Check if there were errors 
   if(data->result == SQL_ERROR) {
+    //half bound parameters are no good for ReuseParameters
+    FREE_PARAMS( self->params, self->paramCount ) ;
+    
     ODBC::CallbackSQLError(
       SQL_HANDLE_STMT,
       self->m_hSTMT,
@@ -927,6 +1211,186 @@ void ODBCStatement::UV_AfterBind(uv_work_t* req, int status) {
   free(req);
 }
 
+/*
+ * NeedParamData
+ *
+ * Called when SQLExecute or SQLParamData stops for a parameter bound with
+ * SQL_DATA_AT_EXEC. Calls the pull function given to execute with the index
+ * of the parameter, and the execution then waits for putData, which sends a
+ * chunk of its value or with null moves on to the next parameter. No thread
+ * of the pool is held while the data is on its way.
+ */
+
+void ODBCStatement::NeedParamData(uv_work_t* req) {
+  DEBUG_PRINTF("ODBCStatement::NeedParamData\n");
+  Nan::HandleScope scope;
+  
+  execute_work_data* data = (execute_work_data *)(req->data);
+  
+  if (data->pull == NULL) {
+    SQLCancel(m_hSTMT);
+    return AbortParamData(req, Nan::Error(
+      "[node-odbc] A stream parameter was bound without a stream to read"));
+  }
+  
+  paramDataReq = req;
+  
+  Local<Value> info[1];
+  
+  //GetStreamParam binds each parameter with its number as the token
+  info[0] = Nan::New<Number>((double) ((intptr_t) data->token - 1));
+  
+  Nan::TryCatch try_catch;
+  
+  data->pull->Call(1, info);
+  
+  if (try_catch.HasCaught()) {
+    FatalException(try_catch);
+  }
+}
+
+/*
+ * AbortParamData
+ *
+ * Ends an execution that stopped for parameter data with an error, once the
+ * data-at-execution sequence has been cancelled.
+ */
+
+void ODBCStatement::AbortParamData(uv_work_t* req, Local<Value> error) {
+  DEBUG_PRINTF("ODBCStatement::AbortParamData\n");
+  
+  execute_work_data* data = (execute_work_data *)(req->data);
+  
+  Local<Value> info[1];
+  
+  info[0] = error;
+  
+  Nan::TryCatch try_catch;
+  
+  data->cb->Call(1, info);
+  
+  if (try_catch.HasCaught()) {
+    FatalException(try_catch);
+  }
+  
+  Unref();
+  delete data->cb;
+  delete data->pull;
+  
+  free(data);
+  free(req);
+}
+
+/*
+ * PutData
+ *
+ * Answers the pull of an execution waiting for parameter data: a Buffer is
+ * sent with SQLPutData, null or undefined ends the value of the parameter
+ * and anything else, such as an error from the stream, cancels the
+ * execution, which calls back with it.
+ */
+
+NAN_METHOD(ODBCStatement::PutData) {
+  DEBUG_PRINTF("ODBCStatement::PutData\n");
+  Nan::HandleScope scope;
+  
+  ODBCStatement* stmt = Nan::ObjectWrap::Unwrap<ODBCStatement>(info.Holder());
+  uv_work_t* work_req = stmt->paramDataReq;
+  
+  if (work_req == NULL) {
+    return Nan::ThrowError("ODBCStatement::PutData(): no parameter is "
+                           "waiting for data.");
+  }
+  
+  execute_work_data* data = (execute_work_data *)(work_req->data);
+  Local<Value> chunk = info[0];
+  
+  //until the next pull
+  stmt->paramDataReq = NULL;
+  
+  if (!stmt->m_hSTMT) {
+    return stmt->AbortParamData(work_req, Nan::Error(
+      "[node-odbc] The statement was closed while sending parameter data"));
+  }
+  
+  if (chunk->IsNull() || chunk->IsUndefined()) {
+    uv_queue_work(
+      uv_default_loop(),
+      work_req,
+      UV_ParamData,
+      data->after);
+  }
+  else if (node::Buffer::HasInstance(chunk)) {
+    stmt->paramChunk.Reset(chunk->ToObject());
+    data->chunk = node::Buffer::Data(chunk);
+    data->chunkLength = node::Buffer::Length(chunk);
+    
+    uv_queue_work(
+      uv_default_loop(),
+      work_req,
+      UV_PutData,
+      (uv_after_work_cb)UV_AfterPutData);
+  }
+  else {
+    SQLCancel(stmt->m_hSTMT);
+    stmt->AbortParamData(work_req, chunk);
+  }
+  
+  info.GetReturnValue().Set(Nan::Undefined());
+}
+
+void ODBCStatement::UV_PutData(uv_work_t* req) {
+  DEBUG_PRINTF("ODBCStatement::UV_PutData\n");
+  
+  execute_work_data* data = (execute_work_data *)(req->data);
+  
+  data->result = SQLPutData(data->stmt->m_hSTMT,
+                            (SQLPOINTER) data->chunk,
+                            (SQLLEN) data->chunkLength);
+}
+
+void ODBCStatement::UV_AfterPutData(uv_work_t* req, int status) {
+  DEBUG_PRINTF("ODBCStatement::UV_AfterPutData\n");
+  Nan::HandleScope scope;
+  
+  execute_work_data* data = (execute_work_data *)(req->data);
+  
+  ODBCStatement* self = data->stmt->self();
+  
+  self->paramChunk.Reset();
+  data->chunk = NULL;
+  data->chunkLength = 0;
+  
+  if (!SQL_SUCCEEDED(data->result)) {
+    Local<Value> error = ODBC::GetSQLError(
+      SQL_HANDLE_STMT,
+      self->m_hSTMT,
+      (char *) "[node-odbc] Error in ODBCStatement::PutData");
+    
+    SQLCancel(self->m_hSTMT);
+    return self->AbortParamData(req, error);
+  }
+  
+  //more of the same parameter
+  self->NeedParamData(req);
+}
+
+/*
+ * UV_ParamData
+ *
+ * Ends the value of a parameter; SQLParamData then asks for the next one or
+ * finishes the execution, and the after callback of the execution takes it
+ * from there.
+ */
+
+void ODBCStatement::UV_ParamData(uv_work_t* req) {
+  DEBUG_PRINTF("ODBCStatement::UV_ParamData\n");
+  
+  execute_work_data* data = (execute_work_data *)(req->data);
+  
+  data->result = SQLParamData(data->stmt->m_hSTMT, &data->token);
+}
+
 /*
  * CloseSync
  */
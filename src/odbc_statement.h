@@ -53,6 +53,10 @@ class ODBCStatement : public Nan::ObjectWrap {
     static void UV_ExecuteNonQuery(uv_work_t* work_req);
     static void UV_AfterExecuteNonQuery(uv_work_t* work_req, int status);
     
+    static NAN_METHOD(ExecuteBatch);
+    static void UV_ExecuteBatch(uv_work_t* work_req);
+    static void UV_AfterExecuteBatch(uv_work_t* work_req, int status);
+    
     static NAN_METHOD(Prepare);
     static void UV_Prepare(uv_work_t* work_req);
     static void UV_AfterPrepare(uv_work_t* work_req, int status);
@@ -61,11 +65,17 @@ class ODBCStatement : public Nan::ObjectWrap {
     static void UV_Bind(uv_work_t* work_req);
     static void UV_AfterBind(uv_work_t* work_req, int status);
     
+    static NAN_METHOD(PutData);
+    static void UV_PutData(uv_work_t* work_req);
+    static void UV_AfterPutData(uv_work_t* work_req, int status);
+    static void UV_ParamData(uv_work_t* work_req);
+    
     //sync methods
     static NAN_METHOD(CloseSync);
     static NAN_METHOD(ExecuteSync);
     static NAN_METHOD(ExecuteDirectSync);
     static NAN_METHOD(ExecuteNonQuerySync);
+    static NAN_METHOD(ExecuteBatchSync);
     static NAN_METHOD(PrepareSync);
     static NAN_METHOD(BindSync);
     
@@ -84,11 +94,20 @@ class ODBCStatement : public Nan::ObjectWrap {
     
     Parameter *params;
     int paramCount;
+    ParameterDescriptorCache paramDescriptors;  // of parameter objects bound
     
     uint16_t *buffer;
     int bufferLength;
-    Column *columns;
-    short colCount;
+    ShapeCache *shapeCache;  // columns of the prepared SQL, shared by results
+    StatementPool *statementPool;  // where m_hSTMT goes when freed
+    
+    uv_work_t *paramDataReq;  // execution waiting for a putData, or NULL
+    Nan::Persistent<Object> paramChunk;  // the Buffer SQLPutData is sending
+    
+    void ResetShapeCache();
+    Local<Object> NewResult();
+    void NeedParamData(uv_work_t* work_req);
+    void AbortParamData(uv_work_t* work_req, Local<Value> error);
 };
 
 struct execute_direct_work_data {
@@ -103,6 +122,18 @@ struct execute_work_data {
   Nan::Callback* cb;
   ODBCStatement *stmt;
   int result;
+  Nan::Callback* pull;     // asked for the data of SQL_DATA_AT_EXEC parameters
+  SQLPOINTER token;        // what SQLParamData gave for the one it wants
+  char *chunk;             // data of stmt->paramChunk
+  size_t chunkLength;
+  uv_after_work_cb after;  // UV_AfterExecute or UV_AfterExecuteNonQuery
+};
+
+struct execute_batch_work_data {
+  Nan::Callback* cb;
+  ODBCStatement *stmt;
+  int result;
+  ParameterBatch *batch;
 };
 
 struct prepare_work_data {
@@ -116,6 +147,7 @@ struct prepare_work_data {
 struct bind_work_data {
   Nan::Callback* cb;
   ODBCStatement *stmt;
+  bool reused;  // the values went into the parameters bound last time
   int result;
 };
 
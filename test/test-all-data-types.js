@@ -31,12 +31,12 @@ var common = require("./common")
     C9: '45.234',
     C10: 'bimal     ',
     C11: 'kumar',
-    C12: '50',
+    C12: new Buffer('50', 'hex'),
     C13: 'jha123456',
     C14: '2015-09-10',
     C15: '10:16:33',
     C16: '2015-09-10 10:16:33.770139',
-    C17: 'abc' } ]);
+    C17: new Buffer('abc') } ]);
 
       });
     });
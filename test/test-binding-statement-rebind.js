@@ -0,0 +1,41 @@
+var common = require("./common")
+  , ibmdb = require("../")
+  , assert = require("assert")
+  , sql = "select cast(? as integer) as N, cast(? as varchar(20)) as S "
+        + "from sysibm.sysdummy1"
+  ;
+
+var conn = ibmdb.openSync(common.connectionString);
+var stmt = conn.prepareSync(sql);
+
+function run(params) {
+  assert.equal(stmt.bindSync(params), true);
+  var result = stmt.executeSync();
+  var data = result.fetchAllSync();
+  result.closeSync();
+  return data[0];
+}
+
+//values of the same types go into the buffers bound by the first bindSync,
+//shorter strings and NULLs included; longer strings and other types rebind
+assert.deepEqual(run([1, 'abc']), { N : 1, S : 'abc' });
+assert.deepEqual(run([2, 'de']), { N : 2, S : 'de' });
+assert.deepEqual(run([3, null]), { N : 3, S : null });
+assert.deepEqual(run([4, 'fgh']), { N : 4, S : 'fgh' });
+assert.deepEqual(run([5, 'a longer string']), { N : 5, S : 'a longer string' });
+assert.deepEqual(run(['6', 'x']), { N : 6, S : 'x' });
+assert.deepEqual(run([null, null]), { N : null, S : null });
+assert.deepEqual(run([7, 'y']), { N : 7, S : 'y' });
+
+stmt.bind([8, 'z'], function (err) {
+  assert.equal(err, null);
+
+  stmt.execute(function (err, result) {
+    assert.equal(err, null);
+    assert.deepEqual(result.fetchAllSync(), [{ N : 8, S : 'z' }]);
+    result.closeSync();
+
+    stmt.closeSync();
+    conn.closeSync();
+  });
+});
@@ -0,0 +1,82 @@
+var common = require("./common")
+  , odbc = require("../")
+  , db = new odbc.Database()
+  , assert = require("assert")
+  , Readable = require("stream").Readable
+  , bytes = new Buffer(300000)
+  , text = new Array(50001).join("abcd")
+  ;
+
+for (var i = 0; i < bytes.length; i++) bytes[i] = i & 0xff;
+
+//a Readable giving data in chunks of size, or failing halfway with error
+function chunked(data, size, error) {
+  var stream = new Readable(), offset = 0;
+
+  stream._read = function () {
+    if (error && offset >= data.length / 2) {
+      return stream.emit('error', error);
+    }
+    var chunk = offset < data.length ? data.slice(offset, offset + size) : null;
+    offset += size;
+    stream.push(chunk);
+  };
+  return stream;
+}
+
+db.openSync(common.connectionString);
+assert.equal(db.connected, true);
+
+try { db.querySync("drop table mylobs"); } catch (e) {}
+db.querySync("create table mylobs (id int, doc CLOB(1M), img BLOB(1M))");
+
+var stmt = db.prepareSync("insert into mylobs values (?, ?, ?)");
+
+//the values arrive chunk by chunk with SQLPutData
+stmt.executeNonQuery([1, { DataType : "CLOB", Data : chunked(text, 7000) },
+                      chunked(bytes, 65536)], function (err, count) {
+  assert.equal(err, null);
+  assert.equal(count, 1);
+
+  //a stream that fails cancels the execution with its error
+  var failure = new Error("read failed");
+
+  stmt.executeNonQuery([2, null, chunked(bytes, 65536, failure)], function (err) {
+    assert.equal(err, failure);
+
+    //the options of a query object still apply
+    db.query({ sql : "update mylobs set img = ? where id = ?",
+               params : [chunked(bytes, 1000), 1], noResults : true },
+             function (err, data) {
+      assert.equal(err, null);
+      assert.deepEqual(data, []);
+
+      var rows = db.querySync("select id, doc, img from mylobs");
+      assert.equal(rows.length, 1);
+      assert.equal(rows[0].DOC, text);
+      assert.deepEqual(rows[0].IMG, bytes);
+
+      //the synchronous execute has no way to read a stream, and neither has
+      //the query of a connection
+      assert.throws(function () {
+        stmt.executeSync([3, null, chunked(bytes, 65536)]);
+      });
+      assert.ok(db.querySync("insert into mylobs values (3, null, ?)",
+        [{ DataType : "BLOB", Data : chunked(bytes, 65536) }]) instanceof TypeError);
+      assert.throws(function () {
+        db.conn.querySync("insert into mylobs values (3, null, ?)",
+          [{ DataType : "BLOB", Data : chunked(bytes, 65536) }]);
+      }, TypeError);
+
+      //only what odbc.js takes for a stream is one, other objects are strings
+      assert.deepEqual(db.querySync("select cast(? as varchar(10)) as A " +
+                                    "from sysibm.sysdummy1",
+        [{ Data : { toString : function () { return "plain"; } } }]),
+        [{ A : "plain" }]);
+
+      stmt.closeSync();
+      db.querySync("drop table mylobs");
+      db.closeSync();
+    });
+  });
+});
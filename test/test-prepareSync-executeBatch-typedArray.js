@@ -0,0 +1,81 @@
+var common = require("./common")
+  , odbc = require("../")
+  , db = new odbc.Database()
+  , assert = require("assert")
+  ;
+
+db.openSync(common.connectionString);
+
+common.dropTables(db, function () {
+  common.createTables(db, function (err) {
+    assert.equal(err, null);
+
+    var stmt = db.conn.prepareSync("insert into " + common.tableName
+                                 + " (COLINT, COLTEXT) values (?, ?)");
+
+    //a TypedArray column is bound as is, with NULLs from a bit mask
+    var ids = new Int32Array([1, 2, 3, 4]);
+    var nulls = Buffer.from ? Buffer.from([0x04]) : new Buffer([0x04]);
+
+    stmt.executeBatch({ columns : [
+      { values : ids, nulls : nulls },
+      ['one', 'two', 'three', 'four']
+    ]}, function (err, result) {
+      assert.equal(err, null);
+      assert.equal(result.rowCount, 4);
+
+      //and so is a Float64Array, here a view into a larger buffer
+      var more = new Float64Array([0, 5, 6, 0]).subarray(1, 3);
+      result = stmt.executeBatchSync({ columns : [more, ['five', 'six']] });
+      assert.equal(result.rowCount, 2);
+
+      var data = db.querySync("select COLINT, COLTEXT from " + common.tableName
+                            + " order by COLTEXT");
+      assert.deepEqual(data, [
+        { COLINT : 5, COLTEXT : 'five' },
+        { COLINT : 4, COLTEXT : 'four' },
+        { COLINT : 1, COLTEXT : 'one' },
+        { COLINT : 6, COLTEXT : 'six' },
+        { COLINT : null, COLTEXT : 'three' },
+        { COLINT : 2, COLTEXT : 'two' }
+      ]);
+
+      //the columns of FETCH_COLUMNAR go back in as they come out
+      var fetched = db.conn.querySync("select COLINT from " + common.tableName
+                                    + " order by COLTEXT");
+      var columns = fetched.fetchAllSync({ fetchMode : odbc.FETCH_COLUMNAR });
+      fetched.closeSync();
+      assert.ok(columns[0].values instanceof Int32Array);
+      result = stmt.executeBatchSync({ columns : [
+        columns[0], ['a', 'b', 'c', 'd', 'e', 'f']
+      ]});
+      assert.equal(result.rowCount, 6);
+      assert.equal(db.querySync("select count(*) as N from " + common.tableName
+                              + " where COLINT is null")[0].N, 2);
+
+      //a BigInt64Array where the node version has BigInt
+      if (typeof BigInt64Array === "function") {
+        var big = new BigInt64Array([BigInt(7), BigInt(8)]);
+        result = stmt.executeBatchSync({ columns : [big, ['seven', 'eight']] });
+        assert.equal(result.rowCount, 2);
+        assert.deepEqual(db.querySync("select COLINT from " + common.tableName
+                                    + " where COLINT > 6 order by COLINT"),
+                         [{ COLINT : 7 }, { COLINT : 8 }]);
+      }
+
+      assert.throws(function () {
+        stmt.executeBatchSync({ columns : [new Int32Array(2), ['x']] });
+      });
+      assert.throws(function () {
+        stmt.executeBatchSync({ columns : [
+          { values : new Int32Array(9), nulls : nulls }, new Array(9)
+        ]});
+      });
+
+      stmt.closeSync();
+      common.dropTables(db, function () {
+        db.closeSync();
+      });
+    });
+  });
+});
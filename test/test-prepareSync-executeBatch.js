@@ -0,0 +1,58 @@
+var common = require("./common")
+  , odbc = require("../")
+  , db = new odbc.Database()
+  , assert = require("assert")
+  ;
+
+db.openSync(common.connectionString);
+
+common.dropTables(db, function () {
+  common.createTables(db, function (err) {
+    assert.equal(err, null);
+
+    var stmt = db.conn.prepareSync("insert into " + common.tableName
+                                 + " (COLINT, COLTEXT) values (?, ?)");
+
+    //rows, with a NULL, go in one execution
+    stmt.executeBatch([[1, 'sandwich'], [2, null], [3, 'scarf']], function (err, result) {
+      assert.equal(err, null);
+      assert.equal(result.rowCount, 3);
+      assert.equal(result.processed, 3);
+      assert.deepEqual(result.status, [odbc.SQL_PARAM_SUCCESS,
+                                       odbc.SQL_PARAM_SUCCESS,
+                                       odbc.SQL_PARAM_SUCCESS]);
+
+      //and so do columns
+      result = stmt.executeBatchSync({ columns : [[4, 5], ['fish', 'chips']] });
+      assert.equal(result.rowCount, 2);
+
+      //each value is converted once, even one that grows each time
+      var calls = 0, growing = { toString : function () {
+        return new Array(++calls * 4).join("ab");
+      } };
+      result = stmt.executeBatchSync([[6, growing]]);
+      assert.equal(result.rowCount, 1);
+      assert.equal(calls, 1);
+
+      var data = db.querySync("select COLINT, COLTEXT from " + common.tableName
+                            + " order by COLINT");
+      assert.deepEqual(data, [
+        { COLINT : 1, COLTEXT : 'sandwich' },
+        { COLINT : 2, COLTEXT : null },
+        { COLINT : 3, COLTEXT : 'scarf' },
+        { COLINT : 4, COLTEXT : 'fish' },
+        { COLINT : 5, COLTEXT : 'chips' },
+        { COLINT : 6, COLTEXT : 'ababab' }
+      ]);
+
+      assert.throws(function () {
+        stmt.executeBatchSync([[7, 'x'], [8]]);
+      });
+
+      stmt.closeSync();
+      common.dropTables(db, function () {
+        db.closeSync();
+      });
+    });
+  });
+});
@@ -0,0 +1,63 @@
+var common = require("./common")
+  , ibmdb = require("../")
+  , assert = require("assert")
+  , sql = "select tabname, tabschema from syscat.tables fetch first 3 rows only"
+  ;
+
+var conn = ibmdb.openSync(common.connectionString);
+
+var expected = conn.querySync(sql);
+assert.equal(expected.length, 3);
+
+//every execution of the prepared SQL gives the same rows, with the keys
+//described by the first one
+var stmt = conn.prepareSync(sql);
+
+for (var i = 0; i < 3; i++) {
+  var result = stmt.executeSync();
+  assert.deepEqual(result.fetchAllSync(), expected);
+  result.closeSync();
+}
+
+stmt.execute(function (err, result) {
+  assert.equal(err, null);
+
+  result.fetchAll(function (err, data) {
+    assert.equal(err, null);
+    assert.deepEqual(data, expected);
+    result.closeSync();
+
+    //preparing other SQL on the statement describes its columns afresh
+    stmt.prepareSync("select 1 as ONE from sysibm.sysdummy1");
+    result = stmt.executeSync();
+    assert.deepEqual(result.fetchAllSync(), [{ ONE : 1 }]);
+    result.closeSync();
+
+    stmt.closeSync();
+
+    //a second result set describes its own columns, even when the first
+    //one was skipped, and the next execution still gets the first one's
+    try { conn.querySync("drop procedure twosets"); } catch (e) {}
+    conn.querySync("create procedure twosets () DYNAMIC RESULT SETS 2 " +
+      "BEGIN " +
+      "DECLARE c1 CURSOR WITH RETURN FOR select 1 as A from sysibm.sysdummy1; " +
+      "DECLARE c2 CURSOR WITH RETURN FOR select 'x' as B, 2 as C from sysibm.sysdummy1; " +
+      "OPEN c1; OPEN c2; END");
+
+    stmt = conn.prepareSync("call twosets()");
+
+    for (var i = 0; i < 2; i++) {
+      result = stmt.executeSync();
+      if (i) {
+        assert.deepEqual(result.fetchAllSync(), [{ A : 1 }]);
+      }
+      assert.equal(result.moreResultsSync(), true);
+      assert.deepEqual(result.fetchAllSync(), [{ B : 'x', C : 2 }]);
+      result.closeSync();
+    }
+
+    stmt.closeSync();
+    conn.querySync("drop procedure twosets");
+    conn.closeSync();
+  });
+});
@@ -0,0 +1,43 @@
+var common = require("./common")
+  , ibmdb = require("../")
+  , assert = require("assert")
+  , sql = "select cast(? as varchar(10)) as A, cast(? as integer) as B from sysibm.sysdummy1"
+  ;
+
+var conn = ibmdb.openSync(common.connectionString);
+
+//the same parameter options bound again with new Data give the new values
+var stmt = conn.prepareSync(sql);
+
+["one", "two", "three"].forEach(function (word, i) {
+  var result = stmt.executeSync([
+    { ParamType : "INPUT", DataType : "VARCHAR", Data : word },
+    { ParamType : "INPUT", DataType : "INTEGER", Data : i }
+  ]);
+  assert.deepEqual(result.fetchAllSync(), [{ A : word, B : i }]);
+  result.closeSync();
+});
+
+stmt.closeSync();
+
+assert.deepEqual(conn.querySync(sql, [{ Data : "four" }, 4]), [{ A : "four", B : 4 }]);
+
+//a value is converted once, so one that grows each time it is read is bound
+//as it was first read
+var calls = 0, growing = { toString : function () {
+  return new Array(++calls * 4).join("ab");
+} };
+assert.deepEqual(conn.querySync(sql, [[1, 1, 12, growing], 7]),
+                 [{ A : "ababab", B : 7 }]);
+assert.equal(calls, 1);
+
+//an object without Data is rejected before anything reaches the server
+var data = conn.querySync(sql, [{ ParamType : "INPUT" }, 5]);
+assert.ok(data instanceof TypeError);
+
+conn.query(sql, [{ DataType : "CHAR" }, 6], function (err, data) {
+  assert.ok(err instanceof TypeError);
+  assert.deepEqual(data, []);
+
+  conn.closeSync();
+});
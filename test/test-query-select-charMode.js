@@ -0,0 +1,31 @@
+//the driver must send SQL_C_CHAR data as UTF-8
+process.env.DB2CODEPAGE = "1208";
+
+var common = require("./common")
+  , odbc = require("../")
+  , db = odbc({ charMode : odbc.CHAR_UTF8 })
+  , assert = require("assert")
+  , sql = "select 'some test' as COLASCII, 'xé€' as COLUTF8, "
+        + "cast(null as varchar(10)) as COLNULL, date('2017-03-04') as COLDATE "
+        + "FROM SYSIBM.SYSDUMMY1"
+  ;
+
+db.openSync(common.connectionString);
+
+assert.equal(db.connected, true);
+
+db.query(sql, function (err, data) {
+  assert.equal(err, null);
+  assert.deepEqual(data, [{ COLASCII : "some test", COLUTF8 : "xé€",
+                            COLNULL : null, COLDATE : "2017-03-04" }]);
+
+  var result = db.conn.querySync(sql);
+  assert.equal(result.charMode, odbc.CHAR_WIDE);
+  result.charMode = odbc.CHAR_UTF8;
+  assert.equal(result.charMode, odbc.CHAR_UTF8);
+  data = result.fetchSync();
+  result.closeSync();
+  assert.equal(data.COLUTF8, "xé€");
+
+  db.closeSync();
+});
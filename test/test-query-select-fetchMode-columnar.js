@@ -0,0 +1,38 @@
+var common = require("./common")
+  , odbc = require("../")
+  , db = odbc({ fetchMode : odbc.FETCH_COLUMNAR })
+  , assert = require("assert")
+  ;
+
+db.openSync(common.connectionString);
+
+assert.equal(db.connected, true);
+
+db.query("select 1 as COLINT, cast(2.5 as double) as COLDBL, 'some test' as COLTEXT FROM SYSIBM.SYSDUMMY1 "
+       + "union all select cast(null as integer), cast(null as double), cast(null as varchar(10)) FROM SYSIBM.SYSDUMMY1 "
+       + "order by 1", function (err, data) {
+  assert.equal(err, null);
+
+  db.closeSync();
+
+  assert.equal(data.length, 3);
+  assert.deepEqual(data.map(function (column) { return column.name; }),
+                   ["COLINT", "COLDBL", "COLTEXT"]);
+
+  //null bitmaps: second row is null in every column
+  data.forEach(function (column) {
+    assert.equal(column.values.length, 2);
+    assert.equal(column.nulls.length, 1);
+    assert.equal(column.nulls[0], 2);
+  });
+
+  assert.equal(data[0].values[0], 1);
+  assert.equal(data[0].values[1], 0);
+  assert.equal(data[1].values[0], 2.5);
+  assert.deepEqual(data[2].values, ["some test", null]);
+
+  if (typeof Int32Array !== "undefined") {
+    assert.ok(data[0].values instanceof Int32Array);
+    assert.ok(data[1].values instanceof Float64Array);
+  }
+});
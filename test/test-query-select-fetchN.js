@@ -0,0 +1,69 @@
+var common = require("./common")
+  , odbc = require("../")
+  , db = new odbc.Database()
+  , assert = require("assert")
+  , sql = "select tabname from syscat.tables fetch first 10 rows only"
+  ;
+
+db.openSync(common.connectionString);
+
+assert.equal(db.connected, true);
+
+var expected = db.conn.querySync(sql).fetchAllSync();
+assert.equal(expected.length, 10);
+
+//10 rows fetched 4 at a time come back as batches of 4, 4, 2 and then none
+db.queryResult(sql, function (err, result) {
+  assert.equal(err, null);
+
+  var batches = [];
+
+  (function next() {
+    result.fetchN(4, function (err, rows) {
+      assert.equal(err, null);
+      batches.push(rows.length);
+
+      if (rows.length) {
+        expected.splice(0, rows.length).forEach(function (row, i) {
+          assert.deepEqual(rows[i], row);
+        });
+        return next();
+      }
+
+      result.closeSync();
+      assert.deepEqual(batches, [4, 4, 2, 0]);
+      assert.equal(expected.length, 0);
+
+      var count = 0;
+      db.queryStream(sql, { highWaterMark : 3 })
+        .on('data', function () { count++; })
+        .on('error', function (err) { throw err; })
+        .on('end', function () {
+          assert.equal(count, 10);
+          partlyRead();
+        });
+    });
+  })();
+});
+
+//closing a partly read result of a statement unbinds the block fetchN left,
+//so the next execution and the collection of the old result are unaffected
+function partlyRead() {
+  var stmt = db.conn.prepareSync(sql);
+  var result = stmt.executeSync();
+
+  result.fetchN(4, function (err, rows) {
+    assert.equal(err, null);
+    assert.equal(rows.length, 4);
+    result.closeSync();
+    result = null;
+
+    var again = stmt.executeSync();
+    if (global.gc) global.gc();
+    assert.equal(again.fetchAllSync().length, 10);
+    again.closeSync();
+
+    stmt.closeSync();
+    db.closeSync();
+  });
+}
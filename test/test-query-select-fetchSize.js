@@ -0,0 +1,28 @@
+var common = require("./common")
+  , odbc = require("../")
+  , db = odbc({ fetchSize : 3 })
+  , assert = require("assert")
+  , sql = "select tabname from syscat.tables fetch first 10 rows only"
+  ;
+
+db.openSync(common.connectionString);
+
+assert.equal(db.connected, true);
+
+//10 rows fetched 3 at a time must come back complete and in order
+var expected = db.conn.querySync(sql).fetchAllSync();
+assert.equal(expected.length, 10);
+
+db.query(sql, function (err, data) {
+  assert.equal(err, null);
+  assert.deepEqual(data, expected);
+
+  var result = db.conn.querySync(sql);
+  assert.equal(result.fetchSize, 10000);
+
+  data = result.fetchAllSync({ fetchSize : 4 });
+  result.closeSync();
+  assert.deepEqual(data, expected);
+
+  db.closeSync();
+});
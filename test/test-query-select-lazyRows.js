@@ -0,0 +1,31 @@
+var common = require("./common")
+  , odbc = require("../")
+  , db = odbc({ lazyRows : true })
+  , assert = require("assert")
+  , sql = "select tabname, tabschema, create_time from syscat.tables fetch first 10 rows only"
+  ;
+
+db.openSync(common.connectionString);
+
+assert.equal(db.connected, true);
+
+var expected = db.conn.querySync(sql).fetchAllSync();
+assert.equal(expected.length, 10);
+
+db.query(sql, function (err, data) {
+  assert.equal(err, null);
+
+  //columns are still listed before they are read
+  assert.deepEqual(Object.keys(data[0]), ["TABNAME", "TABSCHEMA", "CREATE_TIME"]);
+
+  assert.equal(data[1].TABNAME, expected[1].TABNAME);
+  assert.equal(data[1].TABNAME, expected[1].TABNAME);
+
+  data[2].TABSCHEMA = "changed";
+  assert.equal(data[2].TABSCHEMA, "changed");
+
+  expected[2].TABSCHEMA = "changed";
+  assert.deepEqual(JSON.parse(JSON.stringify(data)), JSON.parse(JSON.stringify(expected)));
+
+  db.closeSync();
+});
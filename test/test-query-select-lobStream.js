@@ -0,0 +1,126 @@
+var common = require("./common")
+  , odbc = require("../")
+  , db = new odbc.Database()
+  , assert = require("assert")
+  , text = new Array(20001).join("xé")
+  , bytes = new Buffer(100000)
+  ;
+
+for (var i = 0; i < bytes.length; i++) bytes[i] = i & 0xff;
+
+db.openSync(common.connectionString);
+assert.equal(db.connected, true);
+
+try { db.querySync("drop table mylobs"); } catch (e) {}
+db.querySync("create table mylobs (id int, doc CLOB(1M), img BLOB(1M), empty BLOB(1K))");
+db.querySync("insert into mylobs values (1, ?, ?, null)",
+             [text, {ParamType:"INPUT", DataType:"BLOB", Data:bytes.toString("binary")}]);
+
+function readAll(stream, cb) {
+  var chunks = [];
+  stream.on('data', function (chunk) { chunks.push(chunk); });
+  stream.on('error', cb);
+  stream.on('end', function () {
+    cb(null, typeof chunks[0] === 'string' ? chunks.join('') : Buffer.concat(chunks));
+  });
+}
+
+db.queryResult("select id, doc, img, empty from mylobs", function (err, result) {
+  assert.equal(err, null);
+
+  result.fetch({ streamLobs : true, chunkSize : 4096 }, function (err, row) {
+    assert.equal(err, null);
+    assert.equal(row.ID, 1);
+    assert.equal(row.EMPTY, null);
+
+    readAll(row.DOC, function (err, doc) {
+      assert.equal(err, null);
+      assert.equal(doc, text);
+
+      readAll(row.IMG, function (err, img) {
+        assert.equal(err, null);
+        assert.deepEqual(img, bytes);
+
+        result.fetch({ streamLobs : true }, function (err, row) {
+          assert.equal(err, null);
+          assert.equal(row, null);
+
+          result.closeSync();
+          streamSome();
+        });
+      });
+    });
+  });
+});
+
+function streamSome() {
+  db.queryResult("select id, doc, img from mylobs", function (err, result) {
+    assert.equal(err, null);
+
+    result.fetch({ streamLobs : ["IMG"] }, function (err, row) {
+      assert.equal(err, null);
+      assert.equal(row.DOC, text);
+
+      readAll(row.IMG, function (err, img) {
+        assert.equal(err, null);
+        assert.deepEqual(img, bytes);
+
+        result.closeSync();
+        bothAtOnce();
+      });
+    });
+  });
+}
+
+//two streams of a row read at the same time take turns, and a stream whose
+//row the cursor has moved off fails
+function bothAtOnce() {
+  db.queryResult("select doc, img from mylobs", function (err, result) {
+    assert.equal(err, null);
+
+    result.fetch({ streamLobs : true, chunkSize : 4096 }, function (err, row) {
+      assert.equal(err, null);
+
+      var pending = 2;
+
+      readAll(row.DOC, function (err, doc) {
+        assert.equal(err, null);
+        assert.equal(doc, text);
+        if (--pending === 0) stale(result);
+      });
+
+      readAll(row.IMG, function (err, img) {
+        assert.equal(err, null);
+        assert.deepEqual(img, bytes);
+        if (--pending === 0) stale(result);
+      });
+    });
+  });
+}
+
+function stale(result) {
+  result.closeSync();
+
+  db.queryResult("select doc from mylobs", function (err, result) {
+    assert.equal(err, null);
+
+    result.fetch({ streamLobs : true }, function (err, row) {
+      assert.equal(err, null);
+
+      var doc = row.DOC;
+
+      result.fetch({ streamLobs : true }, function (err, row) {
+        assert.equal(err, null);
+        assert.equal(row, null);
+
+        readAll(doc, function (err) {
+          assert.ok(err instanceof Error);
+
+          result.closeSync();
+          db.querySync("drop table mylobs");
+          db.closeSync();
+        });
+      });
+    });
+  });
+}
@@ -0,0 +1,38 @@
+var common = require("./common")
+  , odbc = require("../")
+  , db = odbc({ decimalMode : odbc.DECIMAL_DOUBLE })
+  , assert = require("assert")
+  , sql = "select cast(9007199254740993 as bigint) as COLBIG, "
+        + "cast(12345.678 as decimal(10,3)) as COLDEC, "
+        + "cast(null as decimal(5,2)) as COLNULL FROM SYSIBM.SYSDUMMY1"
+  ;
+
+db.openSync(common.connectionString);
+
+assert.equal(db.connected, true);
+
+db.query(sql, function (err, data) {
+  assert.equal(err, null);
+  assert.deepEqual(data, [{ COLBIG : "9007199254740993", COLDEC : 12345.678, COLNULL : null }]);
+
+  var result = db.conn.querySync(sql);
+  assert.equal(result.bigintMode, odbc.BIGINT_STRING);
+  assert.equal(result.decimalMode, odbc.DECIMAL_STRING);
+
+  result.decimalMode = odbc.DECIMAL_EXACT;
+  data = result.fetchSync();
+  result.closeSync();
+  assert.equal(data.COLDEC, "12345.678");
+  assert.equal(data.COLNULL, null);
+
+  if (typeof BigInt === "function") {
+    result = db.conn.querySync(sql);
+    result.bigintMode = odbc.BIGINT_NATIVE;
+    data = result.fetchAllSync();
+    result.closeSync();
+    assert.equal(typeof data[0].COLBIG, "bigint");
+    assert.equal(String(data[0].COLBIG), "9007199254740993");
+  }
+
+  db.closeSync();
+});
@@ -0,0 +1,40 @@
+var common = require("./common")
+  , odbc = require("../")
+  , db = odbc({ fetchSize : 3 })
+  , assert = require("assert")
+  , sql = "select tabname from syscat.tables fetch first 10 rows only"
+  ;
+
+db.openSync(common.connectionString);
+
+assert.equal(db.connected, true);
+
+var expected = db.conn.querySync(sql).fetchAllSync();
+assert.equal(expected.length, 10);
+
+//rows come to onRow one at a time and in order, none to the callback
+var seen = [];
+
+db.query({ sql : sql, onRow : function (row, index) {
+  assert.equal(index, seen.length);
+  seen.push(row);
+}}, function (err, data) {
+  assert.equal(err, null);
+  assert.deepEqual(data, []);
+  assert.deepEqual(seen, expected);
+
+  var result = db.conn.querySync(sql);
+  var count = 0;
+
+  result.forEach({ fetchMode : odbc.FETCH_ARRAY }, function (row) {
+    assert.ok(Array.isArray(row));
+    count++;
+  }, function (err, rowCount) {
+    result.closeSync();
+    assert.equal(err, null);
+    assert.equal(rowCount, 10);
+    assert.equal(count, 10);
+
+    db.closeSync();
+  });
+});
@@ -0,0 +1,41 @@
+var common = require("./common")
+  , ibmdb = require("../")
+  , assert = require("assert")
+  , sql = "select cast(? as integer) as N, cast(? as double) as D, "
+        + "cast(? as varchar(100)) as S from sysibm.sysdummy1"
+  ;
+
+var conn = ibmdb.openSync(common.connectionString);
+
+//each query's parameters go in the block of the one before, which has to
+//grow along with the strings and must not leak values between queries
+var count = 0;
+
+(function next(i) {
+  if (i == 20) {
+    //and queries running at the same time each get a block of their own
+    for (var j = 0; j < 5; j++) {
+      (function (j) {
+        conn.query(sql, [j, j / 4, j % 2 ? null : 'x' + j], function (err, data) {
+          assert.equal(err, null);
+          assert.deepEqual(data, [{ N : j, D : j / 4, S : j % 2 ? null : 'x' + j }]);
+
+          if (++count == 5) {
+            assert.deepEqual(conn.querySync(sql, [1, 1.5, 'y']),
+                             [{ N : 1, D : 1.5, S : 'y' }]);
+            conn.closeSync();
+          }
+        });
+      })(j);
+    }
+    return;
+  }
+
+  var text = new Array(i * 5 + 1).join('s');
+
+  conn.query(sql, [i, i + 0.5, text || null], function (err, data) {
+    assert.equal(err, null);
+    assert.deepEqual(data, [{ N : i, D : i + 0.5, S : text || null }]);
+    next(i + 1);
+  });
+})(0);
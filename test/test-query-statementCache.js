@@ -0,0 +1,40 @@
+var common = require("./common")
+  , odbc = require("../")
+  , db = odbc({ statementCacheSize : 2 })
+  , assert = require("assert")
+  , sql = "select tabname from syscat.tables where tabschema = ? fetch first 2 rows only"
+  ;
+
+db.openSync(common.connectionString);
+
+assert.equal(db.connected, true);
+assert.equal(db.conn.statementCacheSize, 2);
+
+//the same SQL with other parameters reuses the statement prepared first
+var first = db.querySync(sql, ['SYSCAT']);
+var second = db.querySync(sql, ['SYSIBM']);
+assert.deepEqual(db.querySync(sql, ['SYSCAT']), first);
+assert.deepEqual(db.querySync(sql, ['SYSIBM']), second);
+assert.deepEqual(db.conn.statementCacheStats,
+                 { size : 2, count : 1, hits : 3, misses : 1 });
+
+db.query(sql, ['SYSCAT'], function (err, data) {
+  assert.equal(err, null);
+  assert.deepEqual(data, first);
+
+  //an open result keeps its statement, so the same SQL gets another one
+  var result = db.conn.querySync(sql, ['SYSCAT']);
+  assert.deepEqual(db.querySync(sql, ['SYSIBM']), second);
+  assert.deepEqual(result.fetchAllSync(), first);
+  result.closeSync();
+  assert.deepEqual(db.conn.statementCacheStats,
+                   { size : 2, count : 2, hits : 5, misses : 2 });
+
+  //shrinking the cache drops the statements beyond the new size
+  db.conn.statementCacheSize = 0;
+  assert.deepEqual(db.querySync(sql, ['SYSCAT']), first);
+  assert.deepEqual(db.conn.statementCacheStats,
+                   { size : 0, count : 0, hits : 5, misses : 2 });
+
+  db.closeSync();
+});
@@ -0,0 +1,57 @@
+var common = require("./common")
+  , odbc = require("../")
+  , db = odbc({ statementPoolSize : 2 })
+  , assert = require("assert")
+  , sql = "select 1 as ONE from sysibm.sysdummy1"
+  ;
+
+db.openSync(common.connectionString);
+
+assert.equal(db.connected, true);
+assert.equal(db.conn.statementPoolSize, 2);
+
+//each query hands its handle back, so the next one reuses it
+for (var i = 0; i < 5; i++) {
+  assert.deepEqual(db.querySync(sql), [{ ONE : 1 }]);
+}
+
+var stats = db.conn.statementPoolStats;
+assert.equal(stats.size, 2);
+assert.equal(stats.inUse, 0);
+assert.equal(stats.idle, 1);
+assert.equal(stats.highWater, 1);
+assert.equal(stats.allocated, 1);
+assert.equal(stats.reused, 4);
+
+//open results keep their handles
+var results = [sql, sql, sql].map(function (s) { return db.conn.querySync(s); });
+assert.equal(db.conn.statementPoolStats.inUse, 3);
+assert.equal(db.conn.statementPoolStats.highWater, 3);
+
+results.forEach(function (result) { result.closeSync(); });
+stats = db.conn.statementPoolStats;
+assert.equal(stats.inUse, 0);
+assert.equal(stats.idle, 2);
+
+//a statement's result only closes the cursor, so the handle the statement
+//hands back to the pool stays good after the result is collected
+(function () {
+  var stmt = db.conn.prepareSync(sql);
+  var result = stmt.executeSync();
+  assert.deepEqual(result.fetchAllSync(), [{ ONE : 1 }]);
+  result.closeSync();
+  stmt.closeSync();
+})();
+
+if (global.gc) global.gc();
+
+assert.deepEqual(db.querySync(sql), [{ ONE : 1 }]);
+assert.equal(db.conn.statementPoolStats.inUse, 0);
+
+db.query(sql, function (err, data) {
+  assert.equal(err, null);
+  assert.deepEqual(data, [{ ONE : 1 }]);
+  assert.equal(db.conn.statementPoolStats.inUse, 0);
+
+  db.closeSync();
+});